@@ -0,0 +1,106 @@
+#ifndef TESTGEN_BENCH_HPP_
+#define TESTGEN_BENCH_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/* Minimal benchmark harness shared by the bench sources.
+ * Every case is repeated until it ran for at least MIN_TIME and at least MIN_REPEATS times,
+ * the fastest repetition is reported. Results are printed as a table and, with '--json <file>',
+ * written as JSON, which scripts/bench_compare.py compares between two versions. */
+namespace bench {
+
+// keeps value alive, so the computation producing it is not optimized away
+template<typename T>
+void keep(T const & value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class Bench {
+    static constexpr double MIN_TIME = 0.2;
+    static constexpr int MIN_REPEATS = 3;
+
+    struct result {
+        std::string name;
+        std::size_t size;
+        std::size_t items; // processed in one repetition, e.g. words, edges or bytes
+        std::string unit;
+        double seconds;    // fastest repetition
+        int repeats;
+    };
+
+    std::string suite;
+    std::string json_path{};
+    std::vector<result> results{};
+
+public:
+    Bench(std::string suite, int argc, char ** argv) :
+      suite{std::move(suite)} {
+        for(int i = 1; i + 1 < argc; ++i) {
+            if(std::strcmp(argv[i], "--json") == 0) {
+                json_path = argv[i + 1];
+            }
+        }
+        std::printf("%-40s %10s %14s %12s\n", this->suite.c_str(), "size", "M units/s", "ms");
+    }
+
+    Bench(Bench const &) = delete;
+    Bench(Bench &&) = delete;
+    Bench & operator=(Bench const &) = delete;
+    Bench & operator=(Bench &&) = delete;
+
+    ~Bench() {
+        if(!json_path.empty()) {
+            writeJson();
+        }
+    }
+
+    // fun() performs one repetition processing 'items' units
+    template<typename Fun>
+    void run(std::string const & name, std::size_t size, std::size_t items, char const * unit, Fun && fun) {
+        using clock = std::chrono::steady_clock;
+        auto best = std::chrono::duration<double>::max().count();
+        auto total = 0.0;
+        auto repeats = 0;
+        while(repeats < MIN_REPEATS || total < MIN_TIME) {
+            auto const start = clock::now();
+            fun();
+            std::chrono::duration<double> const elapsed = clock::now() - start;
+            best = std::min(best, elapsed.count());
+            total += elapsed.count();
+            ++repeats;
+        }
+        std::printf("%-40s %10zu %14.2f %12.3f\n", name.c_str(), size, static_cast<double>(items) / best / 1e6, best * 1e3);
+        std::fflush(stdout);
+        results.push_back({name, size, items, unit, best, repeats});
+    }
+
+private:
+    void writeJson() const {
+        auto * file = std::fopen(json_path.c_str(), "w");
+        if(file == nullptr) {
+            std::perror(json_path.c_str());
+            return;
+        }
+        std::fprintf(file, "{\n  \"suite\": \"%s\",\n  \"compiler\": \"%s\",\n  \"results\": [", suite.c_str(), __VERSION__);
+        for(std::size_t i = 0; i < results.size(); ++i) {
+            auto const & r = results[i];
+            std::fprintf(file,
+                         "%s\n    {\"name\": \"%s\", \"size\": %zu, \"items\": %zu, \"unit\": \"%s\", "
+                         "\"seconds\": %.9g, \"items_per_second\": %.6g, \"repeats\": %d}",
+                         i == 0 ? "" : ",", r.name.c_str(), r.size, r.items, r.unit.c_str(),
+                         r.seconds, static_cast<double>(r.items) / r.seconds, r.repeats);
+        }
+        std::fprintf(file, "\n  ]\n}\n");
+        std::fclose(file);
+    }
+};
+
+} // namespace bench
+
+#endif /* TESTGEN_BENCH_HPP_ */
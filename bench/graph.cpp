@@ -0,0 +1,160 @@
+#include "bench.hpp"
+
+#include <testgen/digraph.hpp>
+#include <testgen/graph.hpp>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace test;
+using bench::keep;
+
+namespace {
+
+constexpr uint SIZES[] = {1U << 10U, 1U << 14U, 1U << 18U, 1U << 20U};
+constexpr uint CLIQUE_SIZES[] = {1U << 6U, 1U << 8U, 1U << 10U};
+constexpr uint IDENTIFY_SIZES[] = {1U << 6U, 1U << 10U, 1U << 14U, 1U << 18U};
+
+std::size_t edgeCount(Graph const & G) {
+    std::size_t res = 0;
+    for(auto const & V : G) {
+        res += V.size();
+    }
+    return res / 2;
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+    bench::Bench bench("graph", argc, argv);
+    gen_type gen{0};
+    for(auto const n : SIZES) {
+        bench.run("Tree::generate", n, n - 1, "edges", [&] {
+            keep(Tree(n).generate(gen).size());
+        });
+        bench.run("Tree::generateCsr", n, n - 1, "edges", [&] {
+            keep(Tree(n).generateCsr(gen).size());
+        });
+        bench.run("UniformTree::generateEdgeList", n, n - 1, "edges", [&] {
+            keep(UniformTree(n).generateEdgeList(gen).size());
+        });
+        bench.run("Path::generate (permuted)", n, n - 1, "edges", [&] {
+            keep(Path(n).generate(gen).size());
+        });
+        bench.run("Path::generateCsr (permuted)", n, n - 1, "edges", [&] {
+            keep(Path(n).generateCsr(gen).size());
+        });
+        bench.run("Path::generateEdgeList (permuted)", n, n - 1, "edges", [&] {
+            keep(Path(n).generateEdgeList(gen).size());
+        });
+        bench.run("Path::streamEdges (permuted)", n, n - 1, "edges", [&] {
+            uint64_t sum = 0;
+            Path(n).streamEdges(gen, [&sum](uint a, uint b) { sum += a ^ b; });
+            keep(sum);
+        });
+        bench.run("RandomTriangulation::generateEdgeList", n, 3 * n - 6, "edges", [&] {
+            keep(RandomTriangulation(n).generateEdgeList(gen).size());
+        });
+        bench.run("Grid::generateCsr (permuted)", n, 2 * n - 64, "edges", [&] {
+            keep(Grid(n / 32, 32).generateCsr(gen).size());
+        });
+        Graph G = Tree(n).generate(gen);
+        bench.run("Graph::permute", n, n - 1, "edges", [&] {
+            G.permute(gen);
+            keep(G.size());
+        });
+        bench.run("Graph::permute (no shuffle)", n, n - 1, "edges", [&] {
+            G.permute(gen, false);
+            keep(G.size());
+        });
+        CsrGraph C(G);
+        bench.run("CsrGraph::permute", n, n - 1, "edges", [&] {
+            C.permute(gen);
+            keep(C.size());
+        });
+    }
+    constexpr uint HUGE_TREE = 10'000'000;
+    bench.run("UniformTree::generateEdgeList", HUGE_TREE, HUGE_TREE - 1, "edges", [&] {
+        keep(UniformTree(HUGE_TREE).generateEdgeList(gen).size());
+    });
+    for(auto const n : CLIQUE_SIZES) {
+        auto const edges = static_cast<std::size_t>(n) * (n - 1) / 2;
+        bench.run("Clique::generate (permuted)", n, edges, "edges", [&] {
+            keep(Clique(n).generate(gen).size());
+        });
+        bench.run("Clique::generateCsr (permuted)", n, edges, "edges", [&] {
+            keep(Clique(n).generateCsr(gen).size());
+        });
+    }
+    for(auto const n : SIZES) {
+        auto const m = static_cast<uint64_t>(n) * 8;
+        auto const p = static_cast<double>(m) / static_cast<double>(detail::pairs_count(n));
+        bench.run("Gnp::generateEdgeList (m = 8n)", n, m, "edges", [&] {
+            keep(Gnp(n, p).generateEdgeList(gen).size());
+        });
+        bench.run("Gnm::generateEdgeList (m = 8n)", n, m, "edges", [&] {
+            keep(Gnm(n, m).generateEdgeList(gen).size());
+        });
+        bench.run("ConnectedGraph::generateEdgeList (m = 8n)", n, m, "edges", [&] {
+            keep(ConnectedGraph(n, m).generateEdgeList(gen).size());
+        });
+        bench.run("Gnm::streamEdges (m = 8n)", n, m, "edges", [&] {
+            uint64_t sum = 0;
+            Gnm(n, m).streamEdges(gen, [&sum](uint a, uint b) { sum += a ^ b; });
+            keep(sum);
+        });
+        bench.run("RandomDag::generate (m = 8n)", n, m, "arcs", [&] {
+            keep(RandomDag(n, m).generate(gen).size());
+        });
+        bench.run("StronglyConnected::generate (m = 8n)", n, m, "arcs", [&] {
+            keep(StronglyConnected(n, m).generate(gen).size());
+        });
+        // about 16 neighbours per vertex
+        constexpr uint RANGE = 1U << 24U;
+        auto const radius = static_cast<uint>(RANGE * std::sqrt(16.0 / (3.14159 * n)));
+        bench.run("UnitDiskGraph::generateEdgeList (m ~ 8n)", n, m, "edges", [&] {
+            keep(UnitDiskGraph(n, RANGE, radius).generateEdgeList(gen).size());
+        });
+        // power law with exponent 3, mean degree about 16
+        std::vector<uint> degrees(n);
+        for(uint v = 0; v < n; ++v) {
+            degrees[v] = static_cast<uint>(8 * std::sqrt(static_cast<double>(n) / (v + 1)));
+        }
+        bench.run("ChungLu::generateEdgeList (m ~ 8n)", n, m, "edges", [&] {
+            keep(ChungLu(degrees).generateEdgeList(gen).size());
+        });
+        bench.run("ChungLu::generateEdgeList (multigraph, m ~ 8n)", n, m, "edges", [&] {
+            keep(ChungLu(degrees, false).generateEdgeList(gen).size());
+        });
+        bench.run("BarabasiAlbert::generateEdgeList (m ~ 8n)", n, m, "edges", [&] {
+            keep(BarabasiAlbert(n, 8).generateEdgeList(gen).size());
+        });
+        bench.run("RandomRegular::generateEdgeList (d = 16)", n, m, "edges", [&] {
+            keep(RandomRegular(n, 16).generateEdgeList(gen).size());
+        });
+        bench.run("Gnm::generate (m = 8n)", n, m, "edges", [&] {
+            keep(Gnm(n, m).generate(gen).size());
+        });
+    }
+    for(auto const n : CLIQUE_SIZES) {
+        auto const m = detail::pairs_count(n) * 3 / 4;
+        bench.run("Gnm::generateEdgeList (dense)", n, m, "edges", [&] {
+            keep(Gnm(n, m).generateEdgeList(gen).size());
+        });
+        bench.run("ConnectedGraph::generateEdgeList (dense)", n, m, "edges", [&] {
+            keep(ConnectedGraph(n, m).generateEdgeList(gen).size());
+        });
+    }
+    for(auto const n : IDENTIFY_SIZES) {
+        Graph const A = Tree(n).generate(gen);
+        Graph const B = Tree(n).generate(gen);
+        std::vector<std::pair<int, int>> pairs;
+        for(uint i = 0; i < n; i += 2) {
+            pairs.emplace_back(i, i);
+        }
+        bench.run("identify", n, edgeCount(A) + edgeCount(B), "edges", [&] {
+            keep(identify(A, B, pairs).size());
+        });
+    }
+}
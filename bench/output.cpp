@@ -0,0 +1,135 @@
+#include "bench.hpp"
+
+#include <testgen/graph.hpp>
+#include <testgen/mapped.hpp>
+#include <testgen/output.hpp>
+#include <testgen/sequence.hpp>
+#include <testgen/weighted.hpp>
+#include <testgen/writer.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace test;
+using bench::keep;
+
+namespace {
+
+constexpr std::size_t SIZES[] = {1U << 10U, 1U << 16U, 1U << 20U};
+constexpr int FILE_ROUNDS = 16; // about 170 MB written to file
+constexpr char const * FILE_NAME = "bench-output.tmp";
+
+} // namespace
+
+int main(int argc, char ** argv) {
+    bench::Bench bench("output", argc, argv);
+    gen_type gen{0};
+    for(auto const size : SIZES) {
+        Sequence<int> const seq(size, uni_dist<int>(-1'000'000'000, 1'000'000'000), gen);
+        std::stringstream sample{};
+        sample << seq;
+        auto const bytes = sample.str().size();
+
+        bench.run("ints std::ostream", size, bytes, "bytes", [&] {
+            std::stringstream out{};
+            for(auto const v : seq) {
+                out << v << ' ';
+            }
+            keep(out.tellp());
+        });
+        bench.run("ints Writer", size, bytes, "bytes", [&] {
+            std::stringstream out{};
+            {
+                Writer writer{out};
+                for(auto const v : seq) {
+                    writer << v << ' ';
+                }
+            }
+            keep(out.tellp());
+        });
+        bench.run("Sequence::operator<<", size, bytes, "bytes", [&] {
+            std::stringstream out{};
+            out << seq;
+            keep(out.tellp());
+        });
+
+        Graph const G = Tree(static_cast<uint>(size)).generate(gen);
+        std::stringstream edges{};
+        printEdges(edges, G);
+        bench.run("printEdges", size, edges.str().size(), "bytes", [&] {
+            std::stringstream out{};
+            printEdges(out, G);
+            keep(out.tellp());
+        });
+        bench.run("printEdges RelabelledGraph", size, edges.str().size(), "bytes", [&] {
+            std::stringstream out{};
+            printEdges(out, RelabelledGraph(G, gen));
+            keep(out.tellp());
+        });
+        CsrGraph const C(G);
+        bench.run("printEdges CsrGraph", size, edges.str().size(), "bytes", [&] {
+            std::stringstream out{};
+            printEdges(out, C);
+            keep(out.tellp());
+        });
+        bench.run("printEdgesAsTree CsrGraph", size, size - 1, "vertices", [&] {
+            std::stringstream out{};
+            printEdgesAsTree(out, C);
+            keep(out.tellp());
+        });
+        bench.run("printParents CsrGraph", size, size, "vertices", [&] {
+            std::stringstream out{};
+            printParents(out, C, 1);
+            keep(out.tellp());
+        });
+        EdgeListGraph const E(G);
+        WeightedGraph W(E);
+        uniformWeights(W, 1, 1'000'000'000, gen);
+        std::stringstream weighted{};
+        printEdges(weighted, W);
+        bench.run("printEdges WeightedGraph", size, weighted.str().size(), "bytes", [&] {
+            std::stringstream out{};
+            printEdges(out, W);
+            keep(out.tellp());
+        });
+        bench.run("printEdges EdgeListGraph", size, edges.str().size(), "bytes", [&] {
+            std::stringstream out{};
+            printEdges(out, E);
+            keep(out.tellp());
+        });
+    }
+
+    constexpr uint HUGE_TREE = 10'000'000;
+    CsrGraph const deep = UniformTree(HUGE_TREE).generateCsr(gen);
+    bench.run("printParents CsrGraph", HUGE_TREE, HUGE_TREE, "vertices", [&] {
+        std::stringstream out{};
+        printParents(out, deep, 1);
+        keep(out.tellp());
+    });
+
+    Sequence<int> const seq(SIZES[2], uni_dist<int>(-1'000'000'000, 1'000'000'000), gen);
+    auto const toFile = [&](auto & stream) {
+        Writer writer{stream};
+        for(int r = 0; r < FILE_ROUNDS; ++r) {
+            writer << seq << '\n';
+        }
+        writer.flush();
+        return static_cast<std::size_t>(stream.tellp());
+    };
+    std::size_t bytes = 0;
+    {
+        std::ofstream out(FILE_NAME);
+        bytes = toFile(out);
+    }
+    bench.run("file std::ofstream", bytes, bytes, "bytes", [&] {
+        std::ofstream out(FILE_NAME);
+        keep(toFile(out));
+    });
+    bench.run("file MappedStream", bytes, bytes, "bytes", [&] {
+        MappedStream<> out(FILE_NAME);
+        keep(toFile(out));
+    });
+    std::remove(FILE_NAME);
+}
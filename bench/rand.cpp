@@ -0,0 +1,99 @@
+#include "bench.hpp"
+
+#include <testgen/rand.hpp>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace test;
+using bench::keep;
+
+namespace {
+
+constexpr std::size_t SIZES[] = {1U << 10U, 1U << 16U, 1U << 22U};
+
+// generator lives behind a reference, as it does inside Testing
+[[gnu::noinline]] void scalarWords(gen_type & gen, uint64_t * out, std::size_t n) {
+    for(std::size_t i = 0; i < n; ++i) {
+        out[i] = gen();
+    }
+}
+
+[[gnu::noinline]] void bulkWords(gen_type & gen, uint64_t * out, std::size_t n) {
+    gen.fill(out, n);
+}
+
+template<std::size_t Lanes>
+[[gnu::noinline]] void simdWords(Xoshiro256ppSimd<Lanes> & gen, uint64_t * out, std::size_t n) {
+    gen.fill(out, n);
+}
+
+[[gnu::noinline]] void scalarInts(gen_type & gen, int32_t * out, std::size_t n, int32_t from, int32_t to) {
+    for(std::size_t i = 0; i < n; ++i) {
+        out[i] = uni_dist<int32_t>::gen(from, to, gen);
+    }
+}
+
+[[gnu::noinline]] void bulkInts(gen_type & gen, int32_t * out, std::size_t n, int32_t from, int32_t to) {
+    uni_dist<int32_t>::fill(from, to, out, n, gen);
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+    bench::Bench bench("rand", argc, argv);
+    for(auto const size : SIZES) {
+        std::vector<uint64_t> words(size);
+        gen_type gen{0};
+        bench.run("Xoshiro256pp::operator()", size, size, "words", [&] {
+            scalarWords(gen, words.data(), size);
+            keep(words.back());
+        });
+        bench.run("Xoshiro256pp::fill", size, size, "words", [&] {
+            bulkWords(gen, words.data(), size);
+            keep(words.back());
+        });
+        Xoshiro256ppSimd<4> simd4{0};
+        bench.run("Xoshiro256ppSimd<4>::fill", size, size, "words", [&] {
+            simdWords(simd4, words.data(), size);
+            keep(words.back());
+        });
+        Xoshiro256ppSimd<8> simd8{0};
+        bench.run("Xoshiro256ppSimd<8>::fill", size, size, "words", [&] {
+            simdWords(simd8, words.data(), size);
+            keep(words.back());
+        });
+    }
+
+    // keep bounds opaque, so the compiler can not specialize division for a constant
+    int32_t volatile from = 1;
+    int32_t volatile to = 1000000;
+    for(auto sampling : {Sampling::LEGACY_MODULO, Sampling::LEMIRE}) {
+        setSampling(sampling);
+        std::string const mode = sampling == Sampling::LEMIRE ? " lemire" : " modulo";
+        for(auto const size : SIZES) {
+            std::vector<int32_t> ints(size);
+            gen_type gen{0};
+            bench.run("uni_dist::gen" + mode, size, size, "samples", [&] {
+                scalarInts(gen, ints.data(), size, from, to);
+                keep(ints.back());
+            });
+            bench.run("uni_dist::fill" + mode, size, size, "samples", [&] {
+                bulkInts(gen, ints.data(), size, from, to);
+                keep(ints.back());
+            });
+        }
+    }
+    setSampling(Sampling::LEMIRE);
+
+    for(auto const size : SIZES) {
+        std::vector<uint> seq(size);
+        std::iota(seq.begin(), seq.end(), 0U);
+        gen_type gen{0};
+        bench.run("shuffle_sequence", size, size, "elements", [&] {
+            shuffle_sequence(seq.begin(), seq.end(), gen);
+            keep(seq.front());
+        });
+    }
+}
@@ -0,0 +1,203 @@
+#ifndef TESTGEN_CHECKS_HPP_
+#define TESTGEN_CHECKS_HPP_
+
+#include "graph.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace test {
+
+/* Graph checkers are function objects returning bool for Graph or CsrGraph, so they can be used as
+ * assumptions and combined with && and ||, e.g. t.assumptionGlobal(IsConnected{} && IsSimple{}).
+ * All of them are iterative and run in O(n + m). Every checker keeps its own scratch buffers,
+ * which grow to the largest graph checked and are reused by later calls. */
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+[[nodiscard]] std::size_t countEdges(GraphT const & g) {
+    std::size_t res = 0;
+    detail::for_each_edge(g, [&res](uint /*unused*/, uint /*unused*/) { ++res; });
+    return res;
+}
+
+namespace detail {
+
+// per-vertex marks which need no clearing between calls: mark is current if it is not older than stamp
+class CheckScratch {
+    std::vector<uint64_t> marks{};
+    uint64_t last{0};
+
+public:
+    std::vector<uint> stack{};
+
+    // marks of n vertices, all of them older than any stamp returned later by fresh()
+    std::vector<uint64_t> & prepare(std::size_t n) {
+        if(marks.size() < n) { marks.resize(n, 0); }
+        stack.clear();
+        return marks;
+    }
+
+    [[nodiscard]] uint64_t fresh() noexcept {
+        return ++last;
+    }
+};
+
+// number of connected components by iterative DFS, stops as soon as there are more than limit
+template<typename GraphT>
+std::size_t count_components(GraphT const & g, CheckScratch & scratch, std::size_t limit = SIZE_MAX) {
+    auto const n = g.size();
+    auto & marks = scratch.prepare(n);
+    auto const stamp = scratch.fresh();
+    std::size_t components = 0;
+    for(uint s = 0; s < n && components <= limit; ++s) {
+        if(marks[s] == stamp) { continue; }
+        ++components;
+        marks[s] = stamp;
+        scratch.stack.push_back(s);
+        while(!scratch.stack.empty()) {
+            auto const w = scratch.stack.back();
+            scratch.stack.pop_back();
+            for(auto v : g[w]) {
+                if(marks[v] != stamp) {
+                    marks[v] = stamp;
+                    scratch.stack.push_back(v);
+                }
+            }
+        }
+    }
+    return components;
+}
+
+} /* namespace detail */
+
+// graph without vertices counts as connected
+class IsConnected {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        return detail::count_components(g, scratch, 1) <= 1;
+    }
+};
+
+// no loops and no multi-edges
+class IsSimple {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        auto const n = g.size();
+        auto & marks = scratch.prepare(n);
+        for(uint w = 0; w < n; ++w) {
+            auto const stamp = scratch.fresh();
+            for(auto v : g[w]) {
+                if(v == w || marks[v] == stamp) { return false; }
+                marks[v] = stamp;
+            }
+        }
+        return true;
+    }
+};
+
+// acyclic, i.e. number of edges is n - (number of components); loops and multi-edges are cycles
+class IsForest {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        return countEdges(g) + detail::count_components(g, scratch) == g.size();
+    }
+};
+
+// connected and acyclic
+class IsTree {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        return g.size() >= 1 && countEdges(g) == g.size() - 1 && detail::count_components(g, scratch, 1) == 1;
+    }
+};
+
+// vertices can be 2-coloured so that every edge joins different colours, iterative DFS
+class IsBipartite {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        auto const n = g.size();
+        auto & marks = scratch.prepare(n);
+        // colour c of vertex visited in this call is stored as base + c
+        auto const base = scratch.fresh();
+        static_cast<void>(scratch.fresh());
+        for(uint s = 0; s < n; ++s) {
+            if(marks[s] >= base) { continue; }
+            marks[s] = base;
+            scratch.stack.push_back(s);
+            while(!scratch.stack.empty()) {
+                auto const w = scratch.stack.back();
+                scratch.stack.pop_back();
+                auto const other = marks[w] == base ? base + 1 : base;
+                for(auto v : g[w]) {
+                    if(marks[v] < base) {
+                        marks[v] = other;
+                        scratch.stack.push_back(v);
+                    } else if(marks[v] != other) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// every degree (number of neighbours on the list, loop counted once) in [min:max]
+class DegreeBounds {
+    std::size_t min;
+    std::size_t max;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    DegreeBounds(std::size_t min, std::size_t max) :
+      min{min}, max{max} {}
+
+    template<typename GraphT>
+    bool operator()(GraphT const & g) const {
+        for(auto const & V : g) {
+            if(V.size() < min || V.size() > max) { return false; }
+        }
+        return true;
+    }
+};
+
+// number of edges (loop counted once) in [min:max]
+class EdgeCount {
+    std::size_t min;
+    std::size_t max;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    EdgeCount(std::size_t min, std::size_t max) :
+      min{min}, max{max} {}
+
+    explicit EdgeCount(std::size_t m) :
+      EdgeCount{m, m} {}
+
+    template<typename GraphT>
+    bool operator()(GraphT const & g) const {
+        auto const edges = countEdges(g);
+        return min <= edges && edges <= max;
+    }
+};
+
+} /* namespace test */
+
+#endif /* TESTGEN_CHECKS_HPP_ */
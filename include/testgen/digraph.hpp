@@ -0,0 +1,234 @@
+#ifndef TESTGEN_DIGRAPH_HPP_
+#define TESTGEN_DIGRAPH_HPP_
+
+#include "graph.hpp"
+#include "rand.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace test {
+
+/* Directed graph in compressed sparse row form: out-neighbours of w are
+ * neighbours[offsets[w]], ..., neighbours[offsets[w + 1] - 1], in order in which arcs were given.
+ * Arc (a, b) goes from a to b and is stored once, loops and multi-arcs are kept. */
+class Digraph {
+    std::vector<std::size_t> offsets;
+    std::vector<uint> neighbours{};
+
+public:
+    using NeighbourRange = CsrGraph::NeighbourRange;
+
+    Digraph() :
+      offsets(1, 0) {}
+
+    // counting sort of arcs by source
+    template<typename List>
+    Digraph(std::size_t n, List const & arcs) :
+      offsets(n + 2, 0) {
+        for(auto [a, b] : arcs) {
+            ++offsets[a + 2];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        neighbours.resize(offsets.back());
+        // offsets[w + 1] is the first free position of w, after the pass it is the end of w
+        for(auto [a, b] : arcs) {
+            neighbours[offsets[a + 1]++] = b;
+        }
+        offsets.pop_back();
+    }
+
+    Digraph(std::size_t n, std::initializer_list<std::pair<uint, uint>> const & arcs) :
+      Digraph(n, std::vector<std::pair<uint, uint>>(arcs)) {}
+
+    [[nodiscard]] NeighbourRange operator[](uint i) const noexcept {
+        return {neighbours.data() + offsets[i], neighbours.data() + offsets[i + 1]};
+    }
+
+    // random labels drawn like in Graph::permute, then out-neighbours of each vertex are shuffled
+    void permute(gen_type & gen, bool shuffle_neighbours = true) {
+        auto const n = size();
+        auto const per = get_permutation(n, gen);
+        std::vector<std::size_t> new_offsets(n + 1, 0);
+        for(uint w = 0; w < n; ++w) {
+            new_offsets[per[w] + 1] = offsets[w + 1] - offsets[w];
+        }
+        std::partial_sum(new_offsets.begin(), new_offsets.end(), new_offsets.begin());
+        std::vector<uint> new_neighbours(neighbours.size());
+        for(uint w = 0; w < n; ++w) {
+            auto const V = (*this)[w];
+            std::transform(V.begin(), V.end(), new_neighbours.begin() + new_offsets[per[w]], [&per](uint v) { return per[v]; });
+        }
+        for(uint w = 0; w < n && shuffle_neighbours; ++w) {
+            shuffle_sequence(new_neighbours.begin() + new_offsets[w], new_neighbours.begin() + new_offsets[w + 1], gen);
+        }
+        offsets = std::move(new_offsets);
+        neighbours = std::move(new_neighbours);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return offsets.size() - 1;
+    }
+
+    [[nodiscard]] std::size_t arcCount() const noexcept {
+        return neighbours.size();
+    }
+
+    // arcs ordered by source
+    [[nodiscard]] edge_list_t getEdges() const {
+        edge_list_t res;
+        res.reserve(arcCount());
+        auto const n = size();
+        for(auto a = 0U; a < n; a++) {
+            for(auto b : (*this)[a]) {
+                res.emplace_back(a, b);
+            }
+        }
+        return res;
+    }
+};
+
+/* CRTP, assumes Derived has 'generateArcs(gen)' method returning arcs of random digraph on n vertices */
+template<typename Derived>
+class RandomDigraphBase : public Generating<Digraph> {
+protected:
+    uint n;
+
+    explicit RandomDigraphBase(uint n) :
+      n{n} {}
+
+public:
+    [[nodiscard]] Digraph generate(gen_type & gen) const override {
+        return Digraph(n, static_cast<const Derived *>(this)->generateArcs(gen));
+    }
+};
+
+/* Acyclic digraph with exactly m distinct arcs, chosen uniformly from arcs going forward in hidden
+ * topological order, expected O(n + m) time. With shuffled = false the order is 0, 1, ..., n - 1,
+ * i.e. every arc goes from smaller to larger label. */
+class RandomDag : public RandomDigraphBase<RandomDag> {
+    uint64_t m;
+    bool shuffled;
+
+public:
+    RandomDag(uint n, uint64_t m, bool shuffled = true) :
+      RandomDigraphBase{n}, m{m}, shuffled{shuffled} {
+        assume(n >= 1U);
+        assume(m <= detail::pairs_count(n));
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        std::vector<uint> order(n);
+        std::iota(order.begin(), order.end(), 0U);
+        if(shuffled) { shuffle_sequence(order.begin(), order.end(), gen); }
+        edge_list_t arcs;
+        arcs.reserve(m);
+        detail::sample_indices(detail::pairs_count(n), m, gen, [&, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            auto const [later, earlier] = cursor(k);
+            arcs.emplace_back(order[earlier], order[later]);
+        });
+        // otherwise out-neighbours would come in topological order
+        if(shuffled) { shuffle_sequence(arcs.begin(), arcs.end(), gen); }
+        return arcs;
+    }
+};
+
+/* Every vertex v has exactly one outgoing arc, to f(v) chosen uniformly from [0, n) (loops allowed). */
+class FunctionalGraph : public RandomDigraphBase<FunctionalGraph> {
+public:
+    explicit FunctionalGraph(uint n) :
+      RandomDigraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        std::vector<uint> f(n);
+        uni_dist<uint>(0, n - 1).fill(f.data(), f.size(), gen);
+        edge_list_t arcs(n);
+        for(auto v = 0U; v < n; ++v) {
+            arcs[v] = {v, f[v]};
+        }
+        return arcs;
+    }
+};
+
+/* Every pair of vertices joined by exactly one arc of random direction, one random bit per pair. */
+class Tournament : public RandomDigraphBase<Tournament> {
+public:
+    explicit Tournament(uint n) :
+      RandomDigraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        constexpr unsigned BITS = 64;
+        edge_list_t arcs;
+        arcs.reserve(detail::pairs_count(n));
+        uint64_t word{};
+        unsigned used = BITS;
+        for(auto a = 0U; a < n; ++a) {
+            for(auto b = a + 1; b < n; ++b) {
+                if(used == BITS) {
+                    word = gen();
+                    used = 0;
+                }
+                if((word >> used++ & 1U) != 0) {
+                    arcs.emplace_back(a, b);
+                } else {
+                    arcs.emplace_back(b, a);
+                }
+            }
+        }
+        return arcs;
+    }
+};
+
+/* Strongly connected digraph without loops and multi-arcs with exactly m arcs: Hamiltonian cycle
+ * and m - n other arcs chosen uniformly from the remaining ones, by rank, so without rejection,
+ * expected O(n + m) time. Labels and order of out-neighbours are random. */
+class StronglyConnected : public RandomDigraphBase<StronglyConnected> {
+    uint64_t m;
+
+public:
+    StronglyConnected(uint n, uint64_t m) :
+      RandomDigraphBase{n}, m{m} {
+        assume(n >= 1U);
+        assume(n == 1U ? m == 0 : n <= m && m <= 2 * detail::pairs_count(n));
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        if(n == 1) { return {}; }
+        auto const label = get_permutation(static_cast<int>(n), gen);
+        edge_list_t arcs;
+        arcs.reserve(m);
+        for(auto i = 0U; i < n; ++i) {
+            arcs.emplace_back(label[i], label[(i + 1) % n]);
+        }
+        // arc (a, b), a != b, has index a(n - 1) + b - [b > a]; cycle arc (i, i + 1) has index i * n
+        // and (n - 1, 0) has index (n - 1)^2, so r-th non-cycle arc is k = r + j with j = number of
+        // cycle arcs smaller than k
+        uint64_t j = 0;
+        auto const cycle_index = [this](uint64_t i) { return i + 1 < n ? i * n : static_cast<uint64_t>(n - 1) * (n - 1); };
+        detail::sample_indices(2 * detail::pairs_count(n) - n, m - n, gen, [&](uint64_t r) {
+            while(j < n && cycle_index(j) <= r + j) {
+                ++j;
+            }
+            auto const k = r + j;
+            auto const a = static_cast<uint>(k / (n - 1));
+            auto b = static_cast<uint>(k % (n - 1));
+            if(b >= a) { ++b; }
+            arcs.emplace_back(label[a], label[b]);
+        });
+        shuffle_sequence(arcs.begin(), arcs.end(), gen);
+        return arcs;
+    }
+};
+
+} /* namespace test */
+
+#endif /* TESTGEN_DIGRAPH_HPP_ */
@@ -4,12 +4,48 @@
 #include "rand.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
 #include <numeric>
+#include <optional>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace test {
 
+using edge_list_t = std::vector<std::pair<uint, uint>>;
+
+namespace detail {
+
+// union-find with path halving, join(a, b) keeps representative of a
+class DisjointSets {
+    std::vector<uint> parent;
+
+public:
+    explicit DisjointSets(std::size_t n) :
+      parent(n) {
+        std::iota(parent.begin(), parent.end(), 0U);
+    }
+
+    [[nodiscard]] uint find(uint v) {
+        while(parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    void join(uint a, uint b) {
+        parent[find(b)] = find(a);
+    }
+};
+
+} /* namespace detail */
+
 class Graph {
     using container_t = std::vector<std::vector<uint>>;
     using edges_container_t = std::vector<std::pair<uint, uint>>;
@@ -21,6 +57,14 @@ public:
     explicit Graph(container_t::size_type n) :
       g{n} {}
 
+    template<typename List>
+    Graph(container_t::size_type n, List const & edges) :
+      g{n} {
+        for(auto [a, b] : edges) {
+            addEdge(a, b);
+        }
+    }
+
     [[nodiscard]] std::vector<uint> & operator[](uint i) {
         return g[i];
     }
@@ -36,31 +80,81 @@ public:
         }
     }
 
-    void permute(gen_type & gen) {
+    // relabels vertices in place: ids in lists are mapped and lists are moved to new positions
+    // by following cycles of permutation, so no list is reallocated
+    // without shuffling neighbours, lists keep order of their (relabelled) elements
+    void permute(gen_type & gen, bool shuffle_neighbours = true) {
         auto const n = g.size();
-        auto const per = get_permutation(n, gen);
-        Graph new_G(g.size());
-        for(uint w = 0; w < n; ++w) {
-            for(auto v : (*this)[w]) {
-                new_G[per[w]].push_back(per[v]);
+        auto per = get_permutation(n, gen);
+        for(auto & V : g) {
+            for(auto & v : V) {
+                v = per[v];
             }
         }
         for(uint w = 0; w < n; ++w) {
-            shuffle_sequence(std::begin(new_G[w]), std::end(new_G[w]), gen);
+            while(per[w] != w) {
+                auto const target = per[w];
+                std::swap(g[w], g[target]);
+                std::swap(per[w], per[target]);
+            }
+        }
+        if(shuffle_neighbours) {
+            for(auto & V : g) {
+                shuffle_sequence(std::begin(V), std::end(V), gen);
+            }
         }
-        *this = std::move(new_G);
     }
 
+    // b is merged into a and left isolated: edge a-b becomes loop at a, loop at b is dropped,
+    // b is removed from lists of its neighbours and a is appended to them
+    // touches only lists of b, a and neighbours of b
     int contract(int a, int b) {
         if(a == b) { return a; }
-        for(auto v : g[b]) {
-            addEdge(a, v);
+        auto const ua = static_cast<uint>(a);
+        auto const ub = static_cast<uint>(b);
+        auto const neighbours = std::move(g[ub]);
+        g[ub].clear();
+        for(auto v : neighbours) {
+            if(v == ub) { continue; }
+            g[ua].push_back(v);
+            if(v != ua) {
+                g[v].resize(std::remove(g[v].begin(), g[v].end(), ub) - g[v].begin());
+                g[v].push_back(ua);
+            }
+        }
+        g[ua].resize(std::remove(g[ua].begin(), g[ua].end(), ub) - g[ua].begin());
+        return a;
+    }
+
+    // contracts all pairs (a, b) at once in O(V + E): vertices connected by pairs are merged
+    // into one, like after contracting pairs one by one, but transitively (contracting (a, b) and
+    // (c, b) merges a, b and c). Pairs are joined in order and (a, b) makes representative of
+    // a's class represent the merged one, so after (a, b) and (c, b) it is c. Other vertices are
+    // left isolated; all loops and multi-edges are kept, also loops that contract(a, b) drops.
+    // Returns representative of every vertex.
+    template<typename List>
+    std::vector<uint> contract(List const & pairs) {
+        auto const n = size();
+        detail::DisjointSets sets(n);
+        for(auto [a, b] : pairs) {
+            sets.join(a, b);
+        }
+        std::vector<uint> representative(n);
+        for(auto i = 0U; i < n; ++i) {
+            representative[i] = sets.find(i);
         }
-        g[b].clear();
+        auto const edges = getEdges();
         for(auto & V : g) {
-            V.resize(remove(V.begin(), V.end(), b) - V.begin());
+            V.clear();
         }
-        return a;
+        for(auto [a, b] : edges) {
+            addEdge(representative[a], representative[b]);
+        }
+        return representative;
+    }
+
+    std::vector<uint> contract(std::initializer_list<std::pair<uint, uint>> const & pairs) {
+        return contract<std::initializer_list<std::pair<uint, uint>>>(pairs);
     }
 
     void makeSimple() {
@@ -126,6 +220,289 @@ public:
     }
 };
 
+/* Immutable graph in compressed sparse row form: neighbours of vertex w are stored in
+ * neighbours[offsets[w]], ..., neighbours[offsets[w + 1] - 1]. Whole graph lives in two arrays,
+ * so it is much cheaper to build and iterate than Graph when there are millions of vertices.
+ * Iteration interface is the same as in Graph, neighbours are in the same order as in Graph
+ * built from the same edges. */
+class CsrGraph {
+public:
+    class NeighbourRange {
+        uint const * first;
+        uint const * last;
+
+    public:
+        NeighbourRange(uint const * first, uint const * last) noexcept :
+          first{first}, last{last} {}
+
+        [[nodiscard]] uint const * begin() const noexcept {
+            return first;
+        }
+
+        [[nodiscard]] uint const * end() const noexcept {
+            return last;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return static_cast<std::size_t>(last - first);
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return first == last;
+        }
+
+        [[nodiscard]] uint operator[](std::size_t i) const noexcept {
+            return first[i];
+        }
+    };
+
+    class VertexIterator {
+        CsrGraph const * graph;
+        uint vertex;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = NeighbourRange;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = NeighbourRange;
+
+        VertexIterator(CsrGraph const * graph, uint vertex) noexcept :
+          graph{graph}, vertex{vertex} {}
+
+        [[nodiscard]] NeighbourRange operator*() const noexcept {
+            return (*graph)[vertex];
+        }
+
+        VertexIterator & operator++() noexcept {
+            ++vertex;
+            return *this;
+        }
+
+        VertexIterator operator++(int) noexcept {
+            auto res = *this;
+            ++vertex;
+            return res;
+        }
+
+        [[nodiscard]] bool operator==(VertexIterator const & x) const noexcept {
+            return vertex == x.vertex;
+        }
+
+        [[nodiscard]] bool operator!=(VertexIterator const & x) const noexcept {
+            return vertex != x.vertex;
+        }
+    };
+
+private:
+    std::vector<std::size_t> offsets;
+    std::vector<uint> neighbours{};
+
+public:
+    CsrGraph() :
+      offsets(1, 0) {}
+
+    // counting sort of edge endpoints, loop (a, a) is stored once like in Graph::addEdge
+    template<typename List>
+    CsrGraph(std::size_t n, List const & edges) :
+      offsets(n + 2, 0) {
+        for(auto [a, b] : edges) {
+            ++offsets[a + 2];
+            if(a != b) { ++offsets[b + 2]; }
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        neighbours.resize(offsets.back());
+        // offsets[w + 1] is the first free position of w, after the pass it is the end of w
+        for(auto [a, b] : edges) {
+            neighbours[offsets[a + 1]++] = b;
+            if(a != b) { neighbours[offsets[b + 1]++] = a; }
+        }
+        offsets.pop_back();
+    }
+
+    CsrGraph(std::size_t n, std::initializer_list<std::pair<uint, uint>> const & edges) :
+      CsrGraph(n, std::vector<std::pair<uint, uint>>(edges)) {}
+
+    explicit CsrGraph(Graph const & G) :
+      offsets(G.size() + 1, 0) {
+        auto const n = G.size();
+        for(auto i = 0U; i < n; ++i) {
+            offsets[i + 1] = offsets[i] + G[i].size();
+        }
+        neighbours.reserve(offsets.back());
+        for(auto const & V : G) {
+            neighbours.insert(neighbours.end(), V.begin(), V.end());
+        }
+    }
+
+    [[nodiscard]] NeighbourRange operator[](uint i) const noexcept {
+        return {neighbours.data() + offsets[i], neighbours.data() + offsets[i + 1]};
+    }
+
+    // same result as Graph::permute on equal Graph with the same generator
+    void permute(gen_type & gen, bool shuffle_neighbours = true) {
+        auto const n = size();
+        auto const per = get_permutation(n, gen);
+        std::vector<std::size_t> new_offsets(n + 1, 0);
+        for(uint w = 0; w < n; ++w) {
+            new_offsets[per[w] + 1] = offsets[w + 1] - offsets[w];
+        }
+        std::partial_sum(new_offsets.begin(), new_offsets.end(), new_offsets.begin());
+        std::vector<uint> new_neighbours(neighbours.size());
+        for(uint w = 0; w < n; ++w) {
+            auto const V = (*this)[w];
+            std::transform(V.begin(), V.end(), new_neighbours.begin() + new_offsets[per[w]], [&per](uint v) { return per[v]; });
+        }
+        for(uint w = 0; w < n && shuffle_neighbours; ++w) {
+            shuffle_sequence(new_neighbours.begin() + new_offsets[w], new_neighbours.begin() + new_offsets[w + 1], gen);
+        }
+        offsets = std::move(new_offsets);
+        neighbours = std::move(new_neighbours);
+    }
+
+    [[nodiscard]] VertexIterator begin() const noexcept {
+        return {this, 0U};
+    }
+
+    [[nodiscard]] VertexIterator end() const noexcept {
+        return {this, static_cast<uint>(size())};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return offsets.size() - 1;
+    }
+
+    [[nodiscard]] edge_list_t getEdges() const {
+        edge_list_t res;
+        auto const n = size();
+        for(auto a = 0U; a < n; a++) {
+            for(auto b : (*this)[a]) {
+                if(a <= b) {
+                    res.emplace_back(a, b);
+                }
+            }
+        }
+        return res;
+    }
+};
+
+/* Graph stored only as list of edges, for generators which only print edges:
+ * no adjacency lists are built, relabelling and printing work directly on the array.
+ * Edges are kept in insertion order and orientation; toGraph() and toCsr() build adjacency form
+ * when neighbours are needed. */
+class EdgeListGraph {
+    std::size_t n;
+    edge_list_t edges{};
+
+public:
+    EdgeListGraph() :
+      EdgeListGraph(0) {}
+    explicit EdgeListGraph(std::size_t n) :
+      n{n} {}
+    EdgeListGraph(std::size_t n, edge_list_t edges) :
+      n{n}, edges{std::move(edges)} {}
+    explicit EdgeListGraph(Graph const & G) :
+      n{G.size()}, edges{G.getEdges()} {}
+
+    void addEdge(uint a, uint b) {
+        edges.emplace_back(a, b);
+    }
+
+    // vertex v becomes label[v]
+    void relabel(std::vector<uint> const & label) {
+        for(auto & [a, b] : edges) {
+            a = label[a];
+            b = label[b];
+        }
+    }
+
+    // random labels, random order of edges and random orientation of each edge
+    void permute(gen_type & gen) {
+        relabel(get_permutation(n, gen));
+        shuffle_sequence(std::begin(edges), std::end(edges), gen);
+        constexpr std::size_t BITS = 64;
+        uint64_t word{};
+        for(std::size_t i = 0; i < edges.size(); ++i) {
+            if(i % BITS == 0) { word = gen(); }
+            if((word >> (i % BITS) & 1U) != 0) {
+                std::swap(edges[i].first, edges[i].second);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return n;
+    }
+
+    [[nodiscard]] edge_list_t const & getEdges() const noexcept {
+        return edges;
+    }
+
+    [[nodiscard]] Graph toGraph() const {
+        return Graph(n, edges);
+    }
+
+    [[nodiscard]] CsrGraph toCsr() const {
+        return CsrGraph(n, edges);
+    }
+};
+
+namespace detail {
+
+// graphs with adjacency lists
+template<typename T>
+inline constexpr bool is_graph_v = std::is_same_v<T, Graph> || std::is_same_v<T, CsrGraph>; //NOLINT(readability-identifier-naming)
+
+// calls fun(a, b) for every edge once, for adjacency graphs in order of getEdges()
+template<typename GraphT, typename Fun>
+void for_each_edge(GraphT const & g, Fun && fun) {
+    if constexpr(is_graph_v<GraphT>) {
+        auto const n = g.size();
+        for(auto a = 0U; a < n; a++) {
+            for(auto b : g[a]) {
+                if(a <= b) {
+                    fun(a, b);
+                }
+            }
+        }
+    } else {
+        for(auto [a, b] : g.getEdges()) {
+            fun(a, b);
+        }
+    }
+}
+
+} /* namespace detail */
+
+/* View of graph with vertex v named label[v]. Labels are applied only when edges are printed,
+ * so graph is neither copied nor modified; it has to outlive the view.
+ * Edges are printed in order of the original graph. */
+template<typename GraphT>
+class RelabelledGraph {
+    GraphT const & g;
+    std::vector<uint> labels;
+
+public:
+    RelabelledGraph(GraphT const & g, std::vector<uint> labels) :
+      g{g}, labels{std::move(labels)} {}
+
+    // random labels
+    RelabelledGraph(GraphT const & g, gen_type & gen) :
+      RelabelledGraph(g, get_permutation(g.size(), gen)) {}
+
+    [[nodiscard]] GraphT const & graph() const noexcept {
+        return g;
+    }
+
+    [[nodiscard]] std::vector<uint> const & label() const noexcept {
+        return labels;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return g.size();
+    }
+};
+
 template<typename List>
 Graph merge(Graph const & ag, Graph const & bg, List const & new_edges) {
     auto const As = ag.size();
@@ -147,13 +524,35 @@ Graph merge(Graph const & ag, Graph const & bg, std::initializer_list<std::pair<
     return merge<std::initializer_list<std::pair<int, int>>>(ag, bg, new_edges);
 }
 
+template<typename List>
+EdgeListGraph merge(EdgeListGraph const & ag, EdgeListGraph const & bg, List const & new_edges) {
+    auto const As = static_cast<uint>(ag.size());
+    edge_list_t edges;
+    edges.reserve(ag.getEdges().size() + bg.getEdges().size() + std::size(new_edges));
+    edges.insert(edges.end(), ag.getEdges().begin(), ag.getEdges().end());
+    for(auto [a, b] : bg.getEdges()) {
+        edges.emplace_back(As + a, As + b);
+    }
+    for(auto [a, b] : new_edges) {
+        edges.emplace_back(a, As + b);
+    }
+    return {ag.size() + bg.size(), std::move(edges)};
+}
+
+EdgeListGraph merge(EdgeListGraph const & ag, EdgeListGraph const & bg, std::initializer_list<std::pair<int, int>> const & new_edges = {}) {
+    return merge<std::initializer_list<std::pair<int, int>>>(ag, bg, new_edges);
+}
+
 template<typename List>
 Graph identify(Graph const & ag, Graph const & bg, List const & vertices) {
-    auto As = ag.size();
+    auto const As = static_cast<uint>(ag.size());
     Graph R = merge(ag, bg, {});
+    edge_list_t pairs;
+    pairs.reserve(std::size(vertices));
     for(auto [a, b] : vertices) {
-        R.contract(a, As + b);
+        pairs.emplace_back(a, As + b);
     }
+    R.contract(pairs);
     R.removeIsolated();
     R.makeSimple();
     return R;
@@ -162,14 +561,73 @@ Graph identify(Graph const & ag, Graph const & bg, List const & vertices) {
 Graph identify(Graph const & ag, Graph const & bg, std::initializer_list<std::pair<int, int>> const & vertices) {
     return identify<std::initializer_list<std::pair<int, int>>>(ag, bg, vertices);
 }
-class Tree : public Generating<Graph> {
+namespace detail {
+
+// default number of edges in one batch of streamBatches
+constexpr std::size_t EDGE_BATCH = std::size_t{1} << 16U;
+
+// stream(f) calls f(a, b) for every edge, consume(edges) gets them in consecutive batches of at most batch edges
+template<typename Stream, typename Consume>
+void stream_batches(Stream && stream, std::size_t batch, Consume && consume) {
+    edge_list_t edges;
+    edges.reserve(batch);
+    stream([&edges, &consume, batch](uint a, uint b) {
+        edges.emplace_back(a, b);
+        if(edges.size() == batch) {
+            consume(std::as_const(edges));
+            edges.clear();
+        }
+    });
+    if(!edges.empty()) { consume(std::as_const(edges)); }
+}
+
+} /* namespace detail */
+
+/* CRTP, assumes Derived has 'generateEdges(gen)' method returning edges of random graph on n vertices
+ * and 'forEachEdge(gen, fun)' method calling fun(a, b) for each of them, in O(n) memory */
+template<typename Derived>
+class RandomGraphBase : public Generating<Graph> {
+protected:
     uint n;
+
+    explicit RandomGraphBase(uint n) :
+      n{n} {}
+
+public:
+    // calls fun(a, b) for every edge of the same graph as generate(gen) would give, edges are not stored
+    template<typename Fun>
+    void streamEdges(gen_type & gen, Fun && fun) const {
+        static_cast<const Derived *>(this)->forEachEdge(gen, std::forward<Fun>(fun));
+    }
+
+    // edges of streamEdges(gen, ...) passed to fun(edge_list_t const &) in batches
+    template<typename Fun>
+    void streamBatches(gen_type & gen, Fun && fun, std::size_t batch = detail::EDGE_BATCH) const {
+        detail::stream_batches([this, &gen](auto && f) { streamEdges(gen, f); }, batch, fun);
+    }
+
+    [[nodiscard]] Graph generate(gen_type & gen) const override {
+        return Graph(n, static_cast<const Derived *>(this)->generateEdges(gen));
+    }
+
+    // same graph as generate(gen) would give
+    [[nodiscard]] CsrGraph generateCsr(gen_type & gen) const {
+        return CsrGraph(n, static_cast<const Derived *>(this)->generateEdges(gen));
+    }
+
+    // same graph as generate(gen) would give
+    [[nodiscard]] EdgeListGraph generateEdgeList(gen_type & gen) const {
+        return {n, static_cast<const Derived *>(this)->generateEdges(gen)};
+    }
+};
+
+class Tree : public RandomGraphBase<Tree> {
     uint range;
 
 public:
     //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
     Tree(uint n, uint range) :
-      n{n}, range{range} {
+      RandomGraphBase{n}, range{range} {
         assume(n >= 1U);
         assume(range >= 1U);
     }
@@ -177,107 +635,987 @@ public:
     explicit Tree(uint n) :
       Tree{n, n} {}
 
-    [[nodiscard]] Graph generate(gen_type & gen) const override {
-        Graph G(n);
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
         for(auto i = 1U; i < n; ++i) {
             const auto begin = static_cast<uint>(std::max(0, static_cast<int>(i) - static_cast<int>(range)));
             const auto end = i - 1;
-            G.addEdge(i, uni_dist<uint>::gen(begin, end, gen));
+            fun(i, uni_dist<uint>::gen(begin, end, gen));
         }
-        return G;
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(n - 1);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+namespace detail {
+
+// k-th pair (a, b) with b < a in order (1, 0), (2, 0), (2, 1), (3, 0), ...
+inline std::pair<uint, uint> pair_from_index(uint64_t k) {
+    auto a = static_cast<uint64_t>((1.0 + std::sqrt(1.0 + 8.0 * static_cast<double>(k))) / 2.0); // NOLINT(*-magic-numbers)
+    while(a * (a - 1) / 2 > k) {
+        --a;
+    }
+    while(a * (a + 1) / 2 <= k) {
+        ++a;
+    }
+    return {static_cast<uint>(a), static_cast<uint>(k - a * (a - 1) / 2)};
+}
+
+// pair_from_index for increasing k, amortized O(1) per call
+struct pair_cursor {
+    uint64_t a{1};
+    uint64_t row{0}; // index of (a, 0)
+
+    [[nodiscard]] std::pair<uint, uint> operator()(uint64_t k) noexcept {
+        while(k >= row + a) {
+            row += a;
+            ++a;
+        }
+        return {static_cast<uint>(a), static_cast<uint>(k - row)};
+    }
+};
+
+inline uint64_t pairs_count(uint n) {
+    return static_cast<uint64_t>(n) * (n - 1) / 2;
+}
+
+// edge array for expected number of edges, with slack of a few standard deviations
+inline edge_list_t reserve_edges(double expected) {
+    edge_list_t edges;
+    edges.reserve(static_cast<std::size_t>(expected + 4 * std::sqrt(expected) + 16)); // NOLINT(*-magic-numbers)
+    return edges;
+}
+
+} /* namespace detail */
+
+/* Erdos-Renyi graph G(n, p): every edge independently with probability p.
+ * Geometric skipping over pairs (Batagelj, Brandes), expected O(n + m) time. */
+class Gnp : public RandomGraphBase<Gnp> {
+    double p;
+
+public:
+    Gnp(uint n, double p) :
+      RandomGraphBase{n}, p{p} {
+        assume(n >= 1U);
+        assume(0 <= p && p <= 1);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::bernoulli_indices(detail::pairs_count(n), p, gen, [&fun, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            auto const [a, b] = cursor(k);
+            fun(a, b);
+        });
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        auto edges = detail::reserve_edges(p * static_cast<double>(detail::pairs_count(n)));
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+/* Erdos-Renyi graph G(n, m): m distinct edges chosen uniformly, expected O(n + m) time.
+ * Edges come sorted by larger endpoint; vertex labels are uniformly random already. */
+class Gnm : public RandomGraphBase<Gnm> {
+    uint64_t m;
+
+public:
+    Gnm(uint n, uint64_t m) :
+      RandomGraphBase{n}, m{m} {
+        assume(n >= 1U);
+        assume(m <= detail::pairs_count(n));
+    }
+
+    // sample is drawn twice instead of being stored, so it is slower than generateEdges
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::sample_indices_replay(detail::pairs_count(n), m, gen, [&fun, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            auto const [a, b] = cursor(k);
+            fun(a, b);
+        });
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(m);
+        detail::sample_indices(detail::pairs_count(n), m, gen, [&edges, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            edges.push_back(cursor(k));
+        });
+        return edges;
+    }
+};
+
+/* Random bipartite graph with parts 0, ..., a - 1 and a, ..., a + b - 1,
+ * each of a * b edges independently with probability p, expected O(a + b + m) time. */
+class BipartiteGnp : public RandomGraphBase<BipartiteGnp> {
+    uint a;
+    uint b;
+    double p;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BipartiteGnp(uint a, uint b, double p) :
+      RandomGraphBase{a + b}, a{a}, b{b}, p{p} {
+        assume(a >= 1U && b >= 1U);
+        assume(0 <= p && p <= 1);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::bernoulli_indices(static_cast<uint64_t>(a) * b, p, gen, [&](uint64_t k) {
+            fun(static_cast<uint>(k / b), static_cast<uint>(a + k % b));
+        });
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        auto edges = detail::reserve_edges(p * static_cast<double>(a) * static_cast<double>(b));
+        forEachEdge(gen, [&edges](uint u, uint v) { edges.emplace_back(u, v); });
+        return edges;
+    }
+};
+
+/* Random bipartite graph with parts 0, ..., a - 1 and a, ..., a + b - 1 and exactly m distinct edges. */
+class BipartiteGnm : public RandomGraphBase<BipartiteGnm> {
+    uint a;
+    uint b;
+    uint64_t m;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BipartiteGnm(uint a, uint b, uint64_t m) :
+      RandomGraphBase{a + b}, a{a}, b{b}, m{m} {
+        assume(a >= 1U && b >= 1U);
+        assume(m <= static_cast<uint64_t>(a) * b);
+    }
+
+    // sample is drawn twice instead of being stored, so it is slower than generateEdges
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::sample_indices_replay(static_cast<uint64_t>(a) * b, m, gen, [&](uint64_t k) {
+            fun(static_cast<uint>(k / b), static_cast<uint>(a + k % b));
+        });
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(m);
+        detail::sample_indices(static_cast<uint64_t>(a) * b, m, gen, [&](uint64_t k) {
+            edges.emplace_back(static_cast<uint>(k / b), static_cast<uint>(a + k % b));
+        });
+        return edges;
+    }
+};
+
+// calls fun(a, b) for edges of tree with given Prufer code (values from [0, n), n = code.size() + 2) in O(n),
+// without heap: the smallest leaf is tracked by pointer which only moves forward
+template<typename Fun>
+void decode_prufer(std::vector<uint> const & code, Fun && fun) {
+    auto const n = code.size() + 2;
+    std::vector<uint> degree(n, 1);
+    for(auto x : code) {
+        ++degree[x];
+    }
+    uint ptr = 0;
+    while(degree[ptr] != 1) {
+        ++ptr;
+    }
+    auto leaf = ptr;
+    for(auto x : code) {
+        fun(leaf, x);
+        if(--degree[x] == 1 && x < ptr) {
+            leaf = x; // new leaf is smaller than any other, take it right away
+        } else {
+            do {
+                ++ptr;
+            } while(degree[ptr] != 1);
+            leaf = ptr;
+        }
+    }
+    fun(leaf, static_cast<uint>(n - 1));
+}
+
+inline edge_list_t decode_prufer(std::vector<uint> const & code) {
+    edge_list_t edges;
+    edges.reserve(code.size() + 1);
+    decode_prufer(code, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+    return edges;
+}
+
+/* Tree chosen uniformly from all n^(n - 2) labelled trees, decoded from random Prufer code in O(n). */
+class UniformTree : public RandomGraphBase<UniformTree> {
+public:
+    explicit UniformTree(uint n) :
+      RandomGraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        if(n == 1) { return; }
+        std::vector<uint> code(n - 2);
+        uni_dist<uint>(0, n - 1).fill(code.data(), code.size(), gen);
+        decode_prufer(code, std::forward<Fun>(fun));
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        if(n == 1) { return {}; }
+        std::vector<uint> code(n - 2);
+        uni_dist<uint>(0, n - 1).fill(code.data(), code.size(), gen);
+        return decode_prufer(code);
+    }
+};
+
+/* Path 0, 1, ..., spine - 1 with each of the other vertices attached to random vertex of the path.
+ * Like in Tree, labels follow the structure. */
+class Caterpillar : public RandomGraphBase<Caterpillar> {
+    uint spine;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Caterpillar(uint n, uint spine) :
+      RandomGraphBase{n}, spine{spine} {
+        assume(1U <= spine && spine <= n);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        for(auto i = 1U; i < spine; ++i) {
+            fun(i - 1, i);
+        }
+        std::vector<uint> legs(n - spine);
+        uni_dist<uint>(0, spine - 1).fill(legs.data(), legs.size(), gen);
+        for(auto i = spine; i < n; ++i) {
+            fun(legs[i - spine], i);
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(n - 1);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+/* Random tree rooted at 0 of height at most depth: every vertex is attached to a random earlier
+ * vertex among these of depth smaller than depth. Labels follow the structure (parent < child). */
+class BoundedDepthTree : public RandomGraphBase<BoundedDepthTree> {
+    uint depth;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BoundedDepthTree(uint n, uint depth) :
+      RandomGraphBase{n}, depth{depth} {
+        assume(n >= 1U);
+        assume(depth >= 1U || n == 1U);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        std::vector<uint> level(n, 0);
+        std::vector<uint> open{0}; // vertices which can get children
+        open.reserve(n);
+        for(auto i = 1U; i < n; ++i) {
+            auto const parent = open[uni_dist<std::size_t>::gen(0, open.size() - 1, gen)];
+            fun(parent, i);
+            level[i] = level[parent] + 1;
+            if(level[i] < depth) {
+                open.push_back(i);
+            }
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(n - 1);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+namespace detail {
+
+// index of pair (a, b) in order of pair_from_index, a != b
+inline uint64_t index_of_pair(uint a, uint b) {
+    if(a < b) { std::swap(a, b); }
+    return static_cast<uint64_t>(a) * (a - 1) / 2 + b;
+}
+
+// LSD radix sort by 16 bits, one pass per 16 significant bits of the maximum;
+// short vectors, for which counting array would dominate, are sorted with std::sort
+inline void radix_sort(std::vector<uint64_t> & values) {
+    constexpr unsigned BITS = 16;
+    constexpr std::size_t BUCKETS = std::size_t{1} << BITS;
+    if(values.size() < BUCKETS) {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+    auto const max = values.empty() ? 0 : *std::max_element(values.begin(), values.end());
+    std::vector<uint64_t> buffer(values.size());
+    std::vector<std::size_t> count(BUCKETS);
+    for(unsigned shift = 0; shift < 64U && (max >> shift) != 0; shift += BITS) {
+        std::fill(count.begin(), count.end(), 0);
+        for(auto v : values) {
+            ++count[(v >> shift) & (BUCKETS - 1)];
+        }
+        std::exclusive_scan(count.begin(), count.end(), count.begin(), std::size_t{0});
+        for(auto v : values) {
+            buffer[count[(v >> shift) & (BUCKETS - 1)]++] = v;
+        }
+        values.swap(buffer);
+    }
+}
+
+} /* namespace detail */
+
+/* Connected simple graph with n vertices and exactly m edges: uniformly random spanning tree
+ * (UniformTree) and m - n + 1 other edges chosen uniformly from the remaining pairs.
+ * Extra edges are sampled by rank among non-tree pairs, so there is no rejection, expected O(n + m)
+ * time and memory also for dense graphs. Edges are returned in random order. */
+class ConnectedGraph : public RandomGraphBase<ConnectedGraph> {
+    uint64_t m;
+
+    // calls fun(a, b) for the m - n + 1 non-tree edges in order of pair index,
+    // tree_edges are read before first call, so fun may append to them
+    template<bool Replay, typename Fun>
+    void forEachExtraEdge(edge_list_t const & tree_edges, gen_type & gen, Fun && fun) const {
+        std::vector<uint64_t> tree(tree_edges.size());
+        std::transform(tree_edges.begin(), tree_edges.end(), tree.begin(), [](auto e) { return detail::index_of_pair(e.first, e.second); });
+        detail::radix_sort(tree);
+        // r-th non-tree pair is k = r + j, where j is number of tree pairs smaller than k
+        std::size_t j = 0;
+        auto on_rank = [&, cursor = detail::pair_cursor{}](uint64_t r) mutable {
+            while(j < tree.size() && tree[j] <= r + j) {
+                ++j;
+            }
+            auto const [a, b] = cursor(r + j);
+            fun(a, b);
+        };
+        auto const N = detail::pairs_count(n) - tree.size();
+        if constexpr(Replay) {
+            detail::sample_indices_replay(N, m - tree.size(), gen, on_rank);
+        } else {
+            detail::sample_indices(N, m - tree.size(), gen, on_rank);
+        }
+    }
+
+public:
+    ConnectedGraph(uint n, uint64_t m) :
+      RandomGraphBase{n}, m{m} {
+        assume(n >= 1U);
+        assume(n - 1 <= m && m <= detail::pairs_count(n));
+    }
+
+    // same edges as generateEdges, but not shuffled: tree edges come first; O(n) memory
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        auto const tree = UniformTree(n).generateEdges(gen);
+        for(auto [a, b] : tree) {
+            fun(a, b);
+        }
+        forEachExtraEdge<true>(tree, gen, fun);
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        auto edges = UniformTree(n).generateEdges(gen);
+        edges.reserve(m);
+        forEachExtraEdge<false>(edges, gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        shuffle_sequence(edges.begin(), edges.end(), gen);
+        return edges;
+    }
+};
+
+/* Random stacked (Apollonian) triangulation: starts with triangle 0, 1, 2 and puts every next vertex
+ * into a face chosen uniformly, joining it with three corners of the face. Result is maximal planar
+ * graph with 3n - 6 edges, O(n) time. Labels follow the structure, 0, 1, 2 is the outer face. */
+class RandomTriangulation : public RandomGraphBase<RandomTriangulation> {
+public:
+    explicit RandomTriangulation(uint n) :
+      RandomGraphBase{n} {
+        assume(n >= 3U);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        fun(0U, 1U);
+        fun(1U, 2U);
+        fun(2U, 0U);
+        std::vector<std::array<uint, 3>> faces{{0, 1, 2}};
+        faces.reserve(2 * static_cast<std::size_t>(n) - 5);
+        for(auto v = 3U; v < n; ++v) {
+            auto const f = uni_dist<std::size_t>::gen(0, faces.size() - 1, gen);
+            auto const [a, b, c] = faces[f];
+            fun(a, v);
+            fun(b, v);
+            fun(c, v);
+            faces[f] = {a, b, v};
+            faces.push_back({b, c, v});
+            faces.push_back({c, a, v});
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(3 * static_cast<std::size_t>(n) - 6);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+using point_list_t = std::vector<std::pair<uint, uint>>;
+
+namespace detail {
+
+/* Calls fun(i, j), i < j, for every pair of points within Euclidean distance radius.
+ * Points are counting-sorted into buckets of spatial hash of cells radius x radius, so only points
+ * from 9 neighbouring cells are compared: expected O(n + number of pairs closer than 2 radius).
+ * Points are visited in bucket order, coordinates are copied in that order for sequential access. */
+template<typename Fun>
+void for_each_close_pair(point_list_t const & points, uint radius, Fun && fun) {
+    constexpr uint64_t MULTIPLIER_X = 0x9E3779B97F4A7C15; // NOLINT(*-magic-numbers)
+    constexpr uint64_t MULTIPLIER_Y = 0xC2B2AE3D27D4EB4F; // NOLINT(*-magic-numbers)
+    assume(radius >= 1U && radius < (1U << 31U));
+    auto const n = points.size();
+    unsigned bits = 1;
+    while((std::size_t{1} << bits) < n) {
+        ++bits;
+    }
+    auto const bucket = [bits](uint64_t cx, uint64_t cy) {
+        return static_cast<std::size_t>((cx * MULTIPLIER_X ^ cy * MULTIPLIER_Y) >> (64U - bits));
+    };
+    std::vector<std::size_t> offsets((std::size_t{1} << bits) + 1, 0);
+    for(auto [x, y] : points) {
+        ++offsets[bucket(x / radius, y / radius) + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<uint> index(n);
+    point_list_t sorted(n);
+    {
+        auto position = offsets;
+        for(uint i = 0; i < n; ++i) {
+            auto const k = position[bucket(points[i].first / radius, points[i].second / radius)]++;
+            index[k] = i;
+            sorted[k] = points[i];
+        }
+    }
+    // radius < 2^31, so r2 < 2^62 and sum of two squares not greater than it does not overflow
+    auto const r2 = static_cast<uint64_t>(radius) * radius;
+    auto const diff = [](uint a, uint b) { return a > b ? a - b : b - a; };
+    for(std::size_t k = 0; k < n; ++k) {
+        auto const [x, y] = sorted[k];
+        uint64_t const cx = x / radius;
+        uint64_t const cy = y / radius;
+        for(auto nx = cx == 0 ? cx : cx - 1; nx <= cx + 1; ++nx) {
+            for(auto ny = cy == 0 ? cy : cy - 1; ny <= cy + 1; ++ny) {
+                auto const b = bucket(nx, ny);
+                for(auto l = std::max(offsets[b], k + 1); l < offsets[b + 1]; ++l) {
+                    auto const [u, v] = sorted[l];
+                    // skip other cells hashed to the same bucket, so every pair is found once
+                    if(u / radius != nx || v / radius != ny) { continue; }
+                    auto const dx = static_cast<uint64_t>(diff(x, u));
+                    auto const dy = static_cast<uint64_t>(diff(y, v));
+                    if(dx <= radius && dy <= radius && dx * dx + dy * dy <= r2) {
+                        fun(std::min(index[k], index[l]), std::max(index[k], index[l]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+} /* namespace detail */
+
+// edges between points within Euclidean distance radius, vertex i is points[i]
+inline edge_list_t unitDiskEdges(point_list_t const & points, uint radius) {
+    edge_list_t edges;
+    detail::for_each_close_pair(points, radius, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+    return edges;
+}
+
+/* Unit disk graph: n points with coordinates uniform in [0:range], joined when they are within
+ * distance radius. Neighbours are found by spatial hashing, expected O(n + m) time for uniform points.
+ * generatePoints(gen) followed by unitDiskEdges(points, radius) gives the same graph with coordinates. */
+class UnitDiskGraph : public RandomGraphBase<UnitDiskGraph> {
+    uint range;
+    uint radius;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    UnitDiskGraph(uint n, uint range, uint radius) :
+      RandomGraphBase{n}, range{range}, radius{radius} {
+        assume(n >= 1U);
+        assume(radius >= 1U && radius < (1U << 31U));
+    }
+
+    [[nodiscard]] point_list_t generatePoints(gen_type & gen) const {
+        std::vector<uint> coordinates(2 * static_cast<std::size_t>(n));
+        uni_dist<uint>(0, range).fill(coordinates.data(), coordinates.size(), gen);
+        point_list_t points(n);
+        for(std::size_t i = 0; i < n; ++i) {
+            points[i] = {coordinates[2 * i], coordinates[2 * i + 1]};
+        }
+        return points;
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::for_each_close_pair(generatePoints(gen), radius, std::forward<Fun>(fun));
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        return unitDiskEdges(generatePoints(gen), radius);
+    }
+};
+
+/* Chung-Lu graph with expected degrees d: sum(d) / 2 edges, both endpoints of each drawn independently
+ * with probability d[v] / sum(d) from alias table, O(1) per edge. Loops are dropped, so expected degree
+ * of v is d[v](1 - d[v] / sum(d)). With simple = true repeated edges are dropped as well (first copy
+ * is kept), which needs O(m) memory also when streaming. Labels are those of d, edges in random order. */
+class ChungLu : public RandomGraphBase<ChungLu> {
+    uint64_t m;
+    std::optional<discrete_dist> endpoints; // only when there are edges to draw
+    bool simple;
+
+public:
+    explicit ChungLu(std::vector<uint> const & degrees, bool simple = true) :
+      RandomGraphBase{static_cast<uint>(degrees.size())},
+      m{std::accumulate(degrees.begin(), degrees.end(), uint64_t{0}) / 2},
+      simple{simple} {
+        if(m != 0) { endpoints.emplace(std::vector<uint64_t>(degrees.begin(), degrees.end())); }
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        if(m == 0) { return; }
+        constexpr std::size_t BLOCK = 1024;
+        std::array<uint, 2 * BLOCK> ends{};
+        std::optional<detail::IndexSet> seen;
+        if(simple) { seen.emplace(m); }
+        for(uint64_t done = 0; done < m; done += BLOCK) {
+            auto const count = static_cast<std::size_t>(std::min<uint64_t>(BLOCK, m - done));
+            endpoints->fill(ends.data(), 2 * count, gen);
+            for(std::size_t i = 0; i < count; ++i) {
+                auto const a = ends[2 * i];
+                auto const b = ends[2 * i + 1];
+                if(a == b || (seen.has_value() && !seen->insert(detail::index_of_pair(a, b)))) { continue; }
+                fun(a, b);
+            }
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(m);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+/* Barabasi-Albert preferential attachment: clique on k + 1 vertices, then every next vertex v is joined
+ * to k distinct earlier vertices, each drawn with probability proportional to its current degree as
+ * a uniform entry of the array of endpoints of all edges so far (Batagelj, Brandes). Repeated targets
+ * are drawn again, O(1) expected per edge. The endpoint array takes O(m) memory also when streaming.
+ * Labels follow the order of arrival, so hubs have small labels. */
+class BarabasiAlbert : public RandomGraphBase<BarabasiAlbert> {
+    uint k;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BarabasiAlbert(uint n, uint k) :
+      RandomGraphBase{n}, k{k} {
+        assume(k >= 1U);
+        assume(n >= k + 1);
+    }
+
+    [[nodiscard]] uint64_t edgeCount() const noexcept {
+        return detail::pairs_count(k + 1) + static_cast<uint64_t>(n - k - 1) * k;
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        std::vector<uint> ends;
+        ends.reserve(2 * edgeCount());
+        for(auto a = 1U; a <= k; ++a) {
+            for(auto b = 0U; b < a; ++b) {
+                fun(a, b);
+                ends.push_back(a);
+                ends.push_back(b);
+            }
+        }
+        // chosen[t] == v if t is already a target of v
+        std::vector<uint> chosen(n, n);
+        for(auto v = k + 1; v < n; ++v) {
+            auto const size = ends.size();
+            for(auto j = 0U; j < k;) {
+                auto const t = ends[uni_dist<std::size_t>::gen(0, size - 1, gen)];
+                if(chosen[t] == v) { continue; }
+                chosen[t] = v;
+                fun(v, t);
+                ends.push_back(v);
+                ends.push_back(t);
+                ++j;
+            }
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(edgeCount());
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
     }
 };
 
+/* Simple graph in which vertex v has degree exactly d[v], by configuration model: array of stubs,
+ * v repeated d[v] times, is shuffled once and consecutive stubs are paired. Loops and repeated edges
+ * are then repaired one by one by switching with uniformly chosen good edge: (a, b), (c, d) become
+ * (a, c), (b, d) if neither is a loop nor already present. Edges are kept in a hash set, so everything
+ * is expected O(n + m) as long as max degree is small compared to sqrt(m), when only O(1 + (max degree)^2)
+ * edges need repair. Dense sequences, with more than half of all pairs as edges, are generated as
+ * complement of graph with degrees n - 1 - d[v], in O(n^2) = O(m) time, so e.g. cliques work too.
+ * Sum of degrees must be even; if repairs take more than 64m + 1024 attempts in total (e.g. when d
+ * is not graphical) generation fails like assume. Labels are those of d, edges are in random order. */
+class ConfigurationModel : public RandomGraphBase<ConfigurationModel> {
+    std::vector<uint> degrees;
+    uint64_t m;
+
+    // pairing and repair of sequence with sum of degrees 2m
+    static edge_list_t pairStubs(std::vector<uint> const & degrees, uint64_t m, gen_type & gen, uint64_t & repairs) {
+        std::vector<uint> stubs;
+        stubs.reserve(2 * m);
+        for(uint v = 0; v < degrees.size(); ++v) {
+            stubs.insert(stubs.end(), degrees[v], v);
+        }
+        shuffle_sequence(stubs.begin(), stubs.end(), gen);
+        edge_list_t edges(m);
+        for(std::size_t i = 0; i < m; ++i) {
+            edges[i] = {stubs[2 * i], stubs[2 * i + 1]};
+        }
+        // first copy of every pair is good and stays in present, loops and later copies are bad
+        detail::IndexSet present(m);
+        std::vector<std::size_t> bad;
+        std::vector<bool> is_bad(m, false);
+        for(std::size_t i = 0; i < m; ++i) {
+            auto const [a, b] = edges[i];
+            if(a == b || !present.insert(detail::index_of_pair(a, b))) {
+                bad.push_back(i);
+                is_bad[i] = true;
+            }
+        }
+        repairs = bad.size();
+        uint64_t attempts = 64 * m + 1024; //NOLINT(*-magic-numbers)
+        for(auto i : bad) {
+            auto const [a, b] = edges[i];
+            while(true) {
+                assume(attempts-- > 0);
+                // one word picks the edge and its orientation
+                auto const r = uni_dist<uint64_t>::gen(0, 2 * m - 1, gen);
+                auto const j = static_cast<std::size_t>(r / 2);
+                if(is_bad[j]) { continue; }
+                auto [c, d] = edges[j];
+                if(r % 2 != 0) { std::swap(c, d); }
+                if(a == c || b == d) { continue; }
+                auto const first = detail::index_of_pair(a, c);
+                auto const second = detail::index_of_pair(b, d);
+                if(first == second || present.contains(first) || present.contains(second)) { continue; }
+                present.erase(detail::index_of_pair(c, d));
+                present.insert(first);
+                present.insert(second);
+                edges[i] = {a, c};
+                edges[j] = {b, d};
+                is_bad[i] = false;
+                break;
+            }
+        }
+        return edges;
+    }
+
+public:
+    explicit ConfigurationModel(std::vector<uint> degrees) :
+      RandomGraphBase{static_cast<uint>(degrees.size())},
+      degrees{std::move(degrees)},
+      m{std::accumulate(this->degrees.begin(), this->degrees.end(), uint64_t{0}) / 2} {
+        assume(std::accumulate(this->degrees.begin(), this->degrees.end(), uint64_t{0}) % 2 == 0);
+        assume(std::all_of(this->degrees.begin(), this->degrees.end(), [this](uint d) { return d < n; }));
+    }
+
+    // repairs is set to the number of switches which were needed to make the graph (or its complement) simple
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen, uint64_t & repairs) const {
+        auto const pairs = detail::pairs_count(n);
+        if(2 * m <= pairs) { return pairStubs(degrees, m, gen, repairs); }
+        std::vector<uint> complement(n);
+        std::transform(degrees.begin(), degrees.end(), complement.begin(), [this](uint d) { return n - 1 - d; });
+        auto const missing = pairStubs(complement, pairs - m, gen, repairs);
+        detail::IndexSet absent(missing.size());
+        for(auto [a, b] : missing) {
+            absent.insert(detail::index_of_pair(a, b));
+        }
+        edge_list_t edges;
+        edges.reserve(m);
+        for(auto a = 1U; a < n; ++a) {
+            for(auto b = 0U; b < a; ++b) {
+                if(!absent.contains(detail::index_of_pair(a, b))) { edges.emplace_back(a, b); }
+            }
+        }
+        shuffle_sequence(edges.begin(), edges.end(), gen);
+        return edges;
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        uint64_t repairs{};
+        return generateEdges(gen, repairs);
+    }
+
+    // same edges as generateEdges, they are generated all at once, so O(n + m) memory
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        for(auto [a, b] : generateEdges(gen)) {
+            fun(a, b);
+        }
+    }
+
+    using RandomGraphBase::generate;
+
+    [[nodiscard]] Graph generate(gen_type & gen, uint64_t & repairs) const {
+        return Graph(n, generateEdges(gen, repairs));
+    }
+};
+
+// uniformly random labelled d-regular graph is approximated by configuration model, n * d must be even
+class RandomRegular : public ConfigurationModel {
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    RandomRegular(uint n, uint d) :
+      ConfigurationModel(std::vector<uint>(n, d)) {
+        assume(d < n);
+    }
+};
+
+/* CRTP, assumes Derived has 'forEachEdge(fun)' method calling fun(a, b) for each edge of graph
+ * on n vertices before random relabelling and 'edgeCount()' method returning their number */
 template<typename Derived>
 class StaticGraphBase : public Generating<Graph> {
+protected:
+    uint n;
+
+    explicit StaticGraphBase(uint n) :
+      n{n} {}
+
 public:
+    [[nodiscard]] edge_list_t generateEdges() const {
+        auto const & derived = *static_cast<const Derived *>(this);
+        edge_list_t edges;
+        edges.reserve(derived.edgeCount());
+        derived.forEachEdge([&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+
+    /* calls fun(a, b) for every edge with random labels, without storing edges: only permutation is kept.
+     * Labels are the same as of generateEdgeList(gen), but edges keep order and orientation of generateEdges(). */
+    template<typename Fun>
+    void streamEdges(gen_type & gen, Fun && fun) const {
+        auto const label = get_permutation(n, gen);
+        static_cast<const Derived *>(this)->forEachEdge([&label, &fun](uint a, uint b) { fun(label[a], label[b]); });
+    }
+
+    // edges of streamEdges(gen, ...) passed to fun(edge_list_t const &) in batches
+    template<typename Fun>
+    void streamBatches(gen_type & gen, Fun && fun, std::size_t batch = detail::EDGE_BATCH) const {
+        detail::stream_batches([this, &gen](auto && f) { streamEdges(gen, f); }, batch, fun);
+    }
+
+    [[nodiscard]] Graph generate() const {
+        return Graph(n, generateEdges());
+    }
+
     [[nodiscard]] Graph generate(gen_type & gen) const override {
-        Graph G = static_cast<const Derived *>(this)->generate();
+        Graph G = generate();
+        G.permute(gen);
+        return G;
+    }
+
+    [[nodiscard]] CsrGraph generateCsr() const {
+        return CsrGraph(n, generateEdges());
+    }
+
+    // same graph as generate(gen) would give
+    [[nodiscard]] CsrGraph generateCsr(gen_type & gen) const {
+        CsrGraph G = generateCsr();
+        G.permute(gen);
+        return G;
+    }
+
+    // randomly relabelled with EdgeListGraph::permute, so it differs from generate(gen)
+    [[nodiscard]] EdgeListGraph generateEdgeList(gen_type & gen) const {
+        EdgeListGraph G{n, generateEdges()};
         G.permute(gen);
         return G;
     }
 };
 
 class Path : public StaticGraphBase<Path> {
-    uint n;
-
 public:
     explicit Path(uint n) :
-      n{n} {
+      StaticGraphBase{n} {
         assume(n >= 1U);
     }
 
-    using StaticGraphBase<Path>::generate;
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n - 1;
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
         for(auto w = 0U; w < n - 1; ++w) {
-            G.addEdge(w, w + 1);
+            fun(w, w + 1);
         }
-        return G;
     }
 };
 
 class Clique : public StaticGraphBase<Clique> {
-    uint n;
-
 public:
     explicit Clique(uint n) :
-      n{n} {
+      StaticGraphBase{n} {
         assume(n >= 1U);
     }
 
-    using StaticGraphBase<Clique>::generate;
+    [[nodiscard]] std::size_t edgeCount() const {
+        return static_cast<std::size_t>(n) * (n - 1) / 2;
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
         for(uint i = 0; i < n; i++) {
             for(uint j = i + 1; j < n; j++) {
-                G.addEdge(i, j);
+                fun(i, j);
             }
         }
-        return G;
     }
 };
 
 class Cycle : public StaticGraphBase<Cycle> {
-    uint n;
-
 public:
     explicit Cycle(uint n) :
-      n{n} {
+      StaticGraphBase{n} {
         assume(n >= 3U);
     }
 
-    using StaticGraphBase<Cycle>::generate;
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n;
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
         for(auto i = 0U; i < n - 1; i++) {
-            G.addEdge(i, i + 1);
+            fun(i, i + 1);
         }
-        G.addEdge(n - 1, 0);
-        return G;
+        fun(n - 1, 0U);
     }
 };
 
 class Star : public StaticGraphBase<Star> {
-    uint n;
-
 public:
     explicit Star(uint n) :
-      n{n} {
+      StaticGraphBase{n} {
         assume(n >= 1U);
     }
 
-    using StaticGraphBase<Star>::generate;
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n - 1;
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
         for(auto i = 1U; i < n; i++) {
-            G.addEdge(0, i + 1);
+            fun(0U, i);
+        }
+    }
+};
+
+/* Path 0, ..., handle - 1 with all other vertices attached to its last vertex. */
+class Broom : public StaticGraphBase<Broom> {
+    uint handle;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Broom(uint n, uint handle) :
+      StaticGraphBase{n}, handle{handle} {
+        assume(1U <= handle && handle <= n);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n - 1;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto i = 1U; i < handle; ++i) {
+            fun(i - 1, i);
+        }
+        for(auto i = handle; i < n; ++i) {
+            fun(handle - 1, i);
+        }
+    }
+};
+
+/* Grid rows x cols, vertex (r, c) is r * cols + c, neighbours are computed arithmetically. */
+class Grid : public StaticGraphBase<Grid> {
+    uint rows;
+    uint cols;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Grid(uint rows, uint cols) :
+      StaticGraphBase{rows * cols}, rows{rows}, cols{cols} {
+        assume(rows >= 1U && cols >= 1U);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return static_cast<std::size_t>(rows) * (cols - 1) + static_cast<std::size_t>(rows - 1) * cols;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto r = 0U; r < rows; ++r) {
+            for(auto c = 0U; c < cols; ++c) {
+                auto const w = r * cols + c;
+                if(c + 1 < cols) { fun(w, w + 1); }
+                if(r + 1 < rows) { fun(w, w + cols); }
+            }
+        }
+    }
+};
+
+/* Grid rows x cols with diagonal (r, c) - (r + 1, c + 1) in every square: planar graph whose inner
+ * faces are all triangles. */
+class TriangulatedGrid : public StaticGraphBase<TriangulatedGrid> {
+    Grid grid;
+    uint rows;
+    uint cols;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    TriangulatedGrid(uint rows, uint cols) :
+      StaticGraphBase{rows * cols}, grid{rows, cols}, rows{rows}, cols{cols} {}
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return grid.edgeCount() + static_cast<std::size_t>(rows - 1) * (cols - 1);
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        grid.forEachEdge(fun);
+        for(auto r = 0U; r + 1 < rows; ++r) {
+            for(auto c = 0U; c + 1 < cols; ++c) {
+                fun(r * cols + c, (r + 1) * cols + c + 1);
+            }
         }
-        return G;
     }
 };
 
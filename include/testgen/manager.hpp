@@ -4,7 +4,12 @@
 #include "rand.hpp"
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <list>
+#include <optional>
+#include <string>
+#include <type_traits>
 #include <unordered_map>
 
 namespace test {
@@ -32,8 +37,29 @@ enum Verbocity {
     VERBOSE = 1
 };
 
+enum Seeding {
+    SEQUENTIAL = 0, // test generators are forked from suite generator in order of first visit
+    INDEXED = 1     // test generator depends only on main seed and (test, suite), so tests can be generated in any order
+};
+
 template<Verbocity Verbose = VERBOSE, typename StreamType = std::ofstream>
 class OIOIOIManager {
+    using index = detail::index;
+
+    struct test_info {
+        std::string filename;
+        gen_type generator;
+        std::optional<StreamType> stream{};
+        bool opened{false};
+        typename std::list<index>::iterator position{}; // in open_streams, valid while stream is open
+
+        test_info(std::string filename, gen_type generator) :
+          filename{std::move(filename)}, generator{generator} {}
+    };
+
+    // streams that can be reopened in append mode are closed when too many of them are open
+    static constexpr bool REOPENABLE = std::is_constructible_v<StreamType, std::string const &, std::ios_base::openmode>;
+
     void changeStream() {
         auto test_name = getFilename();
         if constexpr(Verbose == Verbocity::VERBOSE) {
@@ -41,48 +67,86 @@ class OIOIOIManager {
         }
         auto it = cases.find(curr_index);
         if(it == cases.end()) {
-            it = cases.try_emplace(curr_index,
-                                   std::piecewise_construct,
-                                   std::forward_as_tuple(std::move(test_name)),
-                                   std::forward_as_tuple(getGeneratorForCurrentTest()))
-                     .first;
+            it = cases.try_emplace(curr_index, std::move(test_name), getGeneratorForCurrentTest()).first;
         }
         curr_test = &it->second;
+        openStream(*curr_test);
+    }
+
+    void openStream(test_info & info) {
+        if constexpr(REOPENABLE) {
+            if(info.stream) {
+                open_streams.splice(open_streams.begin(), open_streams, info.position);
+                return;
+            }
+            while(open_streams.size() >= max_open_streams) {
+                cases.at(open_streams.back()).stream.reset(); // flushes and closes
+                open_streams.pop_back();
+            }
+            if(info.opened) {
+                info.stream.emplace(info.filename, std::ios_base::out | std::ios_base::app);
+            } else {
+                info.stream.emplace(info.filename);
+            }
+            open_streams.push_front(curr_index);
+            info.position = open_streams.begin();
+        } else {
+            if(!info.stream) {
+                info.stream.emplace(info.filename);
+            }
+        }
+        info.opened = true;
     }
 
     gen_type getGeneratorForCurrentTest() {
         auto const current_suite_nr = curr_index.suite;
         auto it = suite_generators.find(current_suite_nr);
         if(it == suite_generators.end()) {
-            it = suite_generators.try_emplace(current_suite_nr, main_generator()).first;
+            it = suite_generators.try_emplace(current_suite_nr, getGeneratorForCurrentSuite()).first;
+        }
+        if(seeding == Seeding::INDEXED) {
+            auto gen = it->second;
+            gen.jump(curr_index.test);
+            return gen;
         }
         return it->second.fork();
     }
 
+    gen_type getGeneratorForCurrentSuite() {
+        if(seeding == Seeding::INDEXED) {
+            auto gen = main_generator;
+            gen.longJump(curr_index.suite);
+            return gen;
+        }
+        return gen_type{main_generator()};
+    }
+
     void clearStream() {
         curr_test = nullptr;
     }
 
-    struct test_info : private std::pair<StreamType, gen_type> {
-        using std::pair<StreamType, gen_type>::pair;
-        [[nodiscard]] StreamType & stream() {
-            return this->first;
-        }
-        [[nodiscard]] gen_type & generator() {
-            return this->second;
-        }
-    };
-    using index = detail::index;
     test_info * curr_test{nullptr};
     index curr_index;
     std::string abbr;
     std::unordered_map<index, test_info, index::hash> cases{};
     std::unordered_map<unsigned, gen_type> suite_generators{};
     gen_type main_generator;
+    Seeding seeding;
+    std::list<index> open_streams{}; // most recently used first
+    std::size_t max_open_streams{DEFAULT_MAX_OPEN_STREAMS};
 
 public:
-    explicit OIOIOIManager(std::string abbr, bool ocen = true, uint64_t seed = TESTGEN_SEED) :
-      curr_index{0U, ocen ? 0U : 1U}, abbr{std::move(abbr)}, main_generator{seed} {}
+    using stream_type = StreamType;
+
+    static constexpr std::size_t DEFAULT_MAX_OPEN_STREAMS = 64;
+
+    struct deferred_test {
+        std::string filename;
+        gen_type & generator;
+    };
+
+    explicit OIOIOIManager(std::string abbr, bool ocen = true, uint64_t seed = TESTGEN_SEED, Seeding seeding = Seeding::SEQUENTIAL) :
+      curr_index{0U, ocen ? 0U : 1U}, abbr{std::move(abbr)}, main_generator{seed}, seeding{seeding} {}
 
     OIOIOIManager() = delete;
     OIOIOIManager(OIOIOIManager const &) = delete;
@@ -103,12 +167,24 @@ public:
         generator() = gen_type(seed);
     }
 
+    // affects only suites and tests that were not visited yet
+    void setSeeding(Seeding seeding) noexcept {
+        this->seeding = seeding;
+    }
+
+    // least recently used streams above this limit are closed and reopened in append mode when test is visited again
+    // has no effect if StreamType can not be constructed with (filename, openmode)
+    void setMaxOpenStreams(std::size_t limit) noexcept {
+        assume(limit >= 1);
+        max_open_streams = limit;
+    }
+
     [[nodiscard]] StreamType & stream() const {
-        return curr_test->stream();
+        return *curr_test->stream;
     }
 
     [[nodiscard]] gen_type & generator() const {
-        return curr_test->generator();
+        return curr_test->generator;
     }
 
     void isEmpty() const {
@@ -124,6 +200,22 @@ public:
         this->setTest(curr_index.test + 1, curr_index.suite);
     }
 
+    // moves to next test like nextTest, but instead of opening its stream returns its name and generator,
+    // so test can be generated later, e.g. on another thread; test must not be visited before.
+    // Test is recorded like a visited one: setTest on it later continues its generator and appends to its file.
+    [[nodiscard]] deferred_test deferTest() {
+        curr_index.test++;
+        clearStream();
+        auto test_name = getFilename();
+        if constexpr(Verbose == Verbocity::VERBOSE) {
+            std::cerr << "Deferring: " << test_name << '\n';
+        }
+        auto [it, inserted] = cases.try_emplace(curr_index, test_name, getGeneratorForCurrentTest());
+        assume(inserted);
+        it->second.opened = true;
+        return {std::move(test_name), it->second.generator};
+    }
+
     void nextSuite() {
         curr_index = {0, curr_index.suite + 1};
         clearStream();
@@ -0,0 +1,199 @@
+#ifndef TESTGEN_MAPPED_HPP_
+#define TESTGEN_MAPPED_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <limits>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace test {
+
+/* POSIX only, so this header is not part of merged testgen.hpp and has to be included on its own.
+ *
+ * Output streambuf writing straight into shared memory mapping of the file.
+ * File is mapped in windows of WindowSize bytes; before window is mapped the file is extended
+ * with ftruncate, so there is no write syscall and no second copy in user-space buffer.
+ * On close the file is truncated to number of bytes actually written.
+ * WindowSize has to be multiple of page size and fit in int, as put pointer is moved by pbump. */
+template<std::size_t WindowSize>
+class MappedStreamBuf : public std::streambuf {
+    static_assert(WindowSize % (std::size_t{1} << 16U) == 0, "window has to be aligned to any page size");
+    static_assert(WindowSize <= static_cast<std::size_t>(std::numeric_limits<int>::max()), "pbump takes int offset");
+
+    int fd{-1};
+    char * window{nullptr};
+    off_t window_offset{0};
+    off_t file_size{0}; // size on disk, not less than end of mapped window
+
+    [[nodiscard]] off_t position() const {
+        return window_offset + (pptr() - pbase());
+    }
+
+    bool resize(off_t size) {
+        if(size <= file_size) { return true; }
+        if(::ftruncate(fd, size) != 0) { return false; }
+        file_size = size;
+        return true;
+    }
+
+    bool map(off_t offset) {
+        window_offset = offset;
+        if(!resize(offset + static_cast<off_t>(WindowSize))) { return false; }
+        // not populated up front, with many open files that would fault in whole windows for small tests
+        void * ptr = ::mmap(nullptr, WindowSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+        if(ptr == MAP_FAILED) { return false; }
+        ::madvise(ptr, WindowSize, MADV_SEQUENTIAL);
+        window = static_cast<char *>(ptr);
+        setp(window, window + WindowSize);
+        return true;
+    }
+
+    void unmap() {
+        if(window != nullptr) {
+            window_offset = position();
+            ::munmap(window, WindowSize);
+            window = nullptr;
+            setp(nullptr, nullptr);
+        }
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if(fd < 0) { return traits_type::eof(); }
+        unmap();
+        if(!map(window_offset)) { return traits_type::eof(); }
+        if(!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(char_type const * s, std::streamsize n) override {
+        std::streamsize written = 0;
+        while(written < n) {
+            if(pptr() == epptr() && traits_type::eq_int_type(overflow(traits_type::eof()), traits_type::eof())) {
+                break;
+            }
+            auto const chunk = std::min<std::streamsize>(n - written, epptr() - pptr());
+            std::memcpy(pptr(), s + written, static_cast<std::size_t>(chunk));
+            pbump(static_cast<int>(chunk));
+            written += chunk;
+        }
+        return written;
+    }
+
+    // only reports position, so tellp() works
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if(fd < 0 || off != 0 || dir != std::ios_base::cur || (which & std::ios_base::out) == 0) {
+            return pos_type(off_type(-1));
+        }
+        return pos_type(position());
+    }
+
+    // mapping is shared, so written data is already in page cache
+    int sync() override {
+        return fd < 0 ? -1 : 0;
+    }
+
+public:
+    MappedStreamBuf() = default;
+    MappedStreamBuf(MappedStreamBuf const &) = delete;
+    MappedStreamBuf(MappedStreamBuf &&) = delete;
+    MappedStreamBuf & operator=(MappedStreamBuf const &) = delete;
+    MappedStreamBuf & operator=(MappedStreamBuf &&) = delete;
+    ~MappedStreamBuf() override {
+        close();
+    }
+
+    // with std::ios_base::app writing continues at the end of existing file, otherwise file is truncated
+    bool open(std::string const & filename, std::ios_base::openmode mode) {
+        if(is_open()) { return false; }
+        auto const append = (mode & std::ios_base::app) != 0;
+        fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | (append ? 0 : O_TRUNC), 0644); // NOLINT(*-magic-numbers)
+        if(fd < 0) { return false; }
+        struct stat info {};
+        if(::fstat(fd, &info) != 0) {
+            close();
+            return false;
+        }
+        file_size = info.st_size;
+        auto const end = file_size;
+        auto const offset = end - end % static_cast<off_t>(WindowSize);
+        if(!map(offset)) {
+            close();
+            return false;
+        }
+        pbump(static_cast<int>(end - offset));
+        return true;
+    }
+
+    // truncates file to written size
+    bool close() {
+        if(fd < 0) { return true; }
+        unmap();
+        auto ok = ::ftruncate(fd, window_offset) == 0;
+        ok = (::close(fd) == 0) && ok;
+        fd = -1;
+        window_offset = file_size = 0;
+        return ok;
+    }
+
+    // pre-sizes the file when final size is known, so it is extended once instead of once per window
+    bool reserve(std::size_t size) {
+        return fd >= 0 && resize(static_cast<off_t>(size));
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { // NOLINT(readability-identifier-naming) mimics std::ofstream
+        return fd >= 0;
+    }
+};
+
+/* Drop-in replacement for std::ofstream as StreamType of OIOIOIManager for very large tests. */
+template<std::size_t WindowSize = (std::size_t{1} << 26U)>
+class MappedStream : public std::ostream {
+    MappedStreamBuf<WindowSize> buffer{};
+
+public:
+    explicit MappedStream(std::string const & filename, std::ios_base::openmode mode = std::ios_base::out) :
+      std::ostream{nullptr} {
+        rdbuf(&buffer);
+        if(!buffer.open(filename, mode)) {
+            setstate(std::ios_base::failbit);
+        }
+    }
+    MappedStream(MappedStream const &) = delete;
+    MappedStream(MappedStream &&) = delete;
+    MappedStream & operator=(MappedStream const &) = delete;
+    MappedStream & operator=(MappedStream &&) = delete;
+    ~MappedStream() override = default;
+
+    void close() {
+        if(!buffer.close()) {
+            setstate(std::ios_base::failbit);
+        }
+    }
+
+    void reserve(std::size_t size) {
+        if(!buffer.reserve(size)) {
+            setstate(std::ios_base::failbit);
+        }
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { // NOLINT(readability-identifier-naming) mimics std::ofstream
+        return buffer.is_open();
+    }
+};
+
+} /* namespace test */
+
+#endif /* TESTGEN_MAPPED_HPP_ */
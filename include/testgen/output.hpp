@@ -1,9 +1,17 @@
 #ifndef TESTGEN_OUTPUT_HPP_
 #define TESTGEN_OUTPUT_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
+#include <type_traits>
+#include <vector>
 
+#include "digraph.hpp"
 #include "graph.hpp"
+#include "sequence.hpp"
+#include "weighted.hpp"
+#include "writer.hpp"
 
 namespace test {
 
@@ -26,28 +34,257 @@ public:
     }
 };
 
-void printEdges(std::ostream & s, Graph const & g, int shift = 0) {
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdges(Writer & s, GraphT const & g, int shift = 0) {
+    detail::for_each_edge(g, [&s, shift](uint a, uint b) {
+        s << a + shift << ' ' << b + shift << '\n';
+    });
+}
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdges(std::ostream & s, GraphT const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+namespace detail {
+
+constexpr uint NO_PARENT = ~0U;
+
+// parent of every vertex in tree rooted at root, NO_PARENT for root;
+// DFS with explicit stack, so depth of tree is not limited by call stack
+// g has to be connected, vertex unreachable from root fails like assume
+template<typename GraphT>
+std::vector<uint> tree_parents(GraphT const & g, uint root) {
+    std::vector<uint> parent(g.size(), NO_PARENT);
+    std::vector<uint> stack{root};
+    std::size_t reached = 1;
+    while(!stack.empty()) {
+        auto const w = stack.back();
+        stack.pop_back();
+        for(auto v : g[w]) {
+            if(v != root && parent[v] == NO_PARENT) {
+                parent[v] = w;
+                stack.push_back(v);
+                ++reached;
+            }
+        }
+    }
+    assume(reached == g.size());
+    return parent;
+}
+
+} /* namespace detail */
+
+// parent of every vertex except root, one per line, in order of vertices; g has to be connected
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdgesAsTree(Writer & s, GraphT const & g, int shift = 0, uint root = 0) {
+    auto const parent = detail::tree_parents(g, root);
+    for(uint i = 0; i < g.size(); i++) {
+        if(i != root) {
+            s << static_cast<int64_t>(parent[i]) + shift << '\n';
+        }
+    }
+}
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdgesAsTree(std::ostream & s, GraphT const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printEdgesAsTree(writer, g, shift, root);
+}
+
+// parents of all vertices in one line, root gets shift - 1 (-1 for 0-based, 0 for 1-based labels);
+// g has to be connected
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printParents(Writer & s, GraphT const & g, int shift = 0, uint root = 0) {
+    auto const parent = detail::tree_parents(g, root);
+    for(uint i = 0; i < g.size(); i++) {
+        if(i != 0) { s << ' '; }
+        if(i == root) {
+            s << shift - 1;
+        } else {
+            s << static_cast<int64_t>(parent[i]) + shift;
+        }
+    }
+    s << '\n';
+}
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printParents(std::ostream & s, GraphT const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printParents(writer, g, shift, root);
+}
+
+// edges in stored order and orientation
+void printEdges(Writer & s, EdgeListGraph const & g, int shift = 0) {
     for(auto [a, b] : g.getEdges()) {
         s << a + shift << ' ' << b + shift << '\n';
     }
 }
 
-void printEdgesAsTree(std::ostream & s, Graph const & g, int shift = 0) {
-    std::vector<int> par(g.size());
-    auto dfs = [&g, &par](uint w, uint p, auto && self) -> void {
-        par[w] = p;
-        for(auto v : g[w]) {
-            if(v != p) {
-                self(v, w, self);
+void printEdges(std::ostream & s, EdgeListGraph const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+// needs neighbours, so graph is converted to CsrGraph first
+void printEdgesAsTree(Writer & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    printEdgesAsTree(s, g.toCsr(), shift, root);
+}
+
+void printEdgesAsTree(std::ostream & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printEdgesAsTree(writer, g, shift, root);
+}
+
+// needs neighbours, so graph is converted to CsrGraph first
+void printParents(Writer & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    printParents(s, g.toCsr(), shift, root);
+}
+
+void printParents(std::ostream & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printParents(writer, g, shift, root);
+}
+
+// arc a -> b as 'a b' line, arcs ordered by source
+void printEdges(Writer & s, Digraph const & g, int shift = 0) {
+    for(auto a = 0U; a < g.size(); a++) {
+        for(auto b : g[a]) {
+            s << a + shift << ' ' << b + shift << '\n';
+        }
+    }
+}
+
+void printEdges(std::ostream & s, Digraph const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+// 'a b w' lines, edges in stored order and orientation
+void printEdges(Writer & s, WeightedGraph const & g, int shift = 0) {
+    auto const & edges = g.getEdges();
+    auto const & weights = g.getWeights();
+    for(std::size_t i = 0; i < edges.size(); ++i) {
+        s << edges[i].first + shift << ' ' << edges[i].second + shift << ' ' << weights[i] << '\n';
+    }
+}
+
+void printEdges(std::ostream & s, WeightedGraph const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+template<typename GraphT>
+void printEdges(Writer & s, RelabelledGraph<GraphT> const & g, int shift = 0) {
+    auto const & label = g.label();
+    detail::for_each_edge(g.graph(), [&s, &label, shift](uint a, uint b) {
+        s << label[a] + shift << ' ' << label[b] + shift << '\n';
+    });
+}
+
+template<typename GraphT>
+void printEdges(std::ostream & s, RelabelledGraph<GraphT> const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+/* Edges of graph schema generated with gen straight into output, e.g. t << edgeStream(Path(n), t.generator()).
+ * Graph is never stored: schema.streamEdges passes edges to Writer, whose buffer is flushed in batches.
+ * Schema has to outlive the stream; printing it twice gives two different graphs. */
+template<typename SchemaT>
+class EdgeStream {
+    SchemaT const & schema;
+    gen_type & gen;
+
+public:
+    EdgeStream(SchemaT const & schema, gen_type & gen) :
+      schema{schema}, gen{gen} {}
+
+    template<typename Fun>
+    void operator()(Fun && fun) const {
+        schema.streamEdges(gen, std::forward<Fun>(fun));
+    }
+};
+
+template<typename SchemaT>
+EdgeStream<SchemaT> edgeStream(SchemaT const & schema, gen_type & gen) {
+    return {schema, gen};
+}
+
+template<typename SchemaT>
+void printEdges(Writer & s, EdgeStream<SchemaT> const & g, int shift = 0) {
+    g([&s, shift](uint a, uint b) {
+        s << a + shift << ' ' << b + shift << '\n';
+    });
+}
+
+template<typename SchemaT>
+void printEdges(std::ostream & s, EdgeStream<SchemaT> const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+// edges, one per line
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+Writer & operator<<(Writer & s, GraphT const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+Writer & operator<<(Writer & s, EdgeListGraph const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+Writer & operator<<(Writer & s, Digraph const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+Writer & operator<<(Writer & s, WeightedGraph const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+template<typename GraphT>
+Writer & operator<<(Writer & s, RelabelledGraph<GraphT> const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+template<typename SchemaT>
+Writer & operator<<(Writer & s, EdgeStream<SchemaT> const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+namespace detail {
+
+// integers, strings, sequences and graphs are formatted by writer, anything else by stream;
+// after manipulators like std::setw or std::hex values which stream can print go to stream, so they
+// are formatted as before, graphs are always printed by writer in decimal
+// writer stays buffered between calls and is flushed only before stream prints something,
+// so output keeps its order; owner has to flush writer before stream is switched or closed
+template<typename T>
+void print(Writer & writer, std::ostream & stream, T const & out) {
+    if constexpr(is_writable_v<T>) {
+        if constexpr(is_ostreamable<T>::value) {
+            if(!has_default_format(stream)) {
+                writer.flush();
+                stream << out;
+                return;
             }
         }
-    };
-    dfs(0, -1, dfs);
-    for(uint i = 1; i < g.size(); i++) {
-        s << par[i] + shift << '\n';
+        writer << out;
+    } else {
+        writer.flush();
+        stream << out;
     }
 }
 
+} /* namespace detail */
+
 } /* namespace test */
 
 #endif /* TESTGEN_OUTPUT_HPP_ */
\ No newline at end of file
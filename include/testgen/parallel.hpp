@@ -0,0 +1,38 @@
+#ifndef TESTGEN_PARALLEL_HPP_
+#define TESTGEN_PARALLEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace test {
+
+namespace detail {
+
+// calls fun(i) for every i in [0, count), indices are handed out to threads one by one
+template<typename Fun>
+void parallel_for(std::size_t count, unsigned threads, Fun && fun) {
+    auto const workers = static_cast<std::size_t>(std::max(1U, threads));
+    std::atomic<std::size_t> next{0};
+    auto const worker = [&] {
+        for(std::size_t i{}; (i = next++) < count;) {
+            fun(i);
+        }
+    };
+    std::vector<std::thread> pool;
+    for(std::size_t t = 1; t < std::min(workers, count); ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for(auto & thread : pool) {
+        thread.join();
+    }
+}
+
+} /* namespace detail */
+
+} /* namespace test */
+
+#endif /* TESTGEN_PARALLEL_HPP_ */
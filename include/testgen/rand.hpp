@@ -5,20 +5,221 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 constexpr uint64_t TESTGEN_SEED = 0;
 
 namespace test {
 
+template<std::size_t Lanes>
+class Xoshiro256ppSimd;
+
+namespace detail {
+/* Polynomials over GF(2) of degree < 256, bit b of word w is coefficient of x^(64w + b).
+ * Advancing xoshiro256 by k steps is multiplication of its state by x^k mod P,
+ * where P is characteristic polynomial of its transition matrix. */
+using jump_poly_t = std::array<uint64_t, 4>;
+
+// lower 256 bits of P, coefficient of x^256 is 1
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+constexpr jump_poly_t CHARACTERISTIC_POLYNOMIAL = {0x9d116f2bb0f0f001ULL, 0x0280002bcefd1a5eULL, 0x04b4edcf26259f85ULL, 0x0003c03c3f3ecb19ULL};
+
+// x * a mod P
+constexpr jump_poly_t poly_mulx(jump_poly_t a) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    auto const overflow = (a[3] >> 63U) != 0;
+    for(auto i = a.size() - 1; i > 0; --i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        a[i] = (a[i] << 1U) | (a[i - 1] >> 63U);
+    }
+    a[0] <<= 1U;
+    if(overflow) {
+        for(std::size_t i = 0; i < a.size(); ++i) {
+            a[i] ^= CHARACTERISTIC_POLYNOMIAL[i];
+        }
+    }
+    return a;
+}
+
+// a * b mod P
+constexpr jump_poly_t poly_mulmod(jump_poly_t const & a, jump_poly_t b) {
+    constexpr unsigned WORD_WIDTH = 64;
+    jump_poly_t res{};
+    for(auto word : a) {
+        for(unsigned bit = 0; bit < WORD_WIDTH; ++bit) {
+            if((word >> bit & 1U) != 0) {
+                for(std::size_t i = 0; i < res.size(); ++i) {
+                    res[i] ^= b[i];
+                }
+            }
+            b = poly_mulx(b);
+        }
+    }
+    return res;
+}
+
+// JUMP_POLYNOMIALS[k] = x^(2^(128 + k)) mod P, generated by scripts/jump_polynomials.py
+// k = 0 and k = 64 are reference JUMP and LONG_JUMP constants of xoshiro256++
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+inline constexpr std::array<jump_poly_t, 128> JUMP_POLYNOMIALS = {{
+    {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL},
+    {0x8cfe9bd9ab71d992ULL, 0xccfc8ca2814de79eULL, 0xa5a28cccb37dba5bULL, 0xa23e49ee6f1a7a8dULL},
+    {0x1b2a94a672a48c05ULL, 0x5e38f4fbb6fcda72ULL, 0xca8a45310219dc67ULL, 0xd4e9921bccb8090bULL},
+    {0xf30974a2b1dbbb71ULL, 0x34cd4cc8228d74acULL, 0xfa0587a90f717438ULL, 0xee658f69deb5df26ULL},
+    {0xb42bd4670583b289ULL, 0xd2c0d8e0c8a2fb9bULL, 0x2573e3218d8bb7daULL, 0xd7aaaf48aa459c58ULL},
+    {0xf6a5ab84efb67883ULL, 0xcc7efdcfed1ac303ULL, 0xd82be75b83dbc2d0ULL, 0x8fd437c01abeab24ULL},
+    {0xc85ee5171484f5a4ULL, 0xedc8b8d02a22310bULL, 0xb0b87a330b854c8aULL, 0x7d16742eceb4d5abULL},
+    {0x4298ba0e862a6007ULL, 0x4157dc48443e3565ULL, 0x13c97c0891cab48aULL, 0x6533981804b420eaULL},
+    {0xee5f5a6f02dfe47cULL, 0xedc28c89cb341660ULL, 0x613b2ed9f0acc107ULL, 0xa1ee335d14807ae0ULL},
+    {0x5ec3050c6b43565aULL, 0x4b26f71c1fb1b47bULL, 0x0531513e8e0ac706ULL, 0x799d469b2145a8a3ULL},
+    {0x34f0a6799020283eULL, 0x7123f2290a1f413bULL, 0xb6acd7be4906b73dULL, 0x6007bb31ec5a2964ULL},
+    {0xaa0711c54877febdULL, 0x54fe6df4cff0db73ULL, 0x7e42d6f544840499ULL, 0xec907801890a47abULL},
+    {0x03833e601d82a673ULL, 0x3ec263f5c999196eULL, 0xd8c4367e574ab160ULL, 0x964e9d188c16508eULL},
+    {0xd64f3f2aaf8f2171ULL, 0xf524fd4408357a5cULL, 0x15ac212f3b861b5aULL, 0x24d9ba21277dd8d8ULL},
+    {0xfe9b778d7d1ca2deULL, 0xbbe0e2c0c44b2e1cULL, 0x17a7af3e97d8c402ULL, 0xf89354cfe1e6b5fbULL},
+    {0x695cf225704e767dULL, 0xf4873d277cd1ab72ULL, 0xaad8c318bc459cceULL, 0xb89526857566cd94ULL},
+    {0x3dcd32f39276a95fULL, 0xc51212c8b1aa2787ULL, 0x962c90a866ea6719ULL, 0xb81875d0f4f6f253ULL},
+    {0xb43cf8e4eaf8e068ULL, 0x1c554e97b2277f47ULL, 0xa5a140826c351d07ULL, 0x11495a1b200d4eb8ULL},
+    {0x417b73b324735d32ULL, 0xff957b6f55288048ULL, 0x05af69bf1fb82891ULL, 0x3e53bfa0db28e110ULL},
+    {0xb6c7a6004612889cULL, 0xfdb3f4ea18f0a56bULL, 0xd3da65e82bdd39e2ULL, 0x48f6214560239b46ULL},
+    {0xf1267ba0ec3c645eULL, 0xd9dc0929a54fea75ULL, 0xec60b640d685171dULL, 0xde364ef64a484f59ULL},
+    {0x2761cbab38e0f580ULL, 0xd7f1c5ade3de404aULL, 0xcb6286958a9af01aULL, 0x2b29c7d3ef18d3b3ULL},
+    {0x5a5ce93f67a3cdd6ULL, 0x547db3576511edc2ULL, 0x99455c744595c01fULL, 0x6a3b6a431109e3d1ULL},
+    {0xafd80c1c832a739eULL, 0x0d9d73da9f40f374ULL, 0xed1d0a619aa60748ULL, 0x00d2333b0c03f620ULL},
+    {0x11428ceb13f2cc2cULL, 0xef46e42368baead3ULL, 0x2a47bd3fc39081daULL, 0x3f03458e0273439bULL},
+    {0x47558e815c898e8bULL, 0x9f8160e9d0124398ULL, 0x0fdcfd4ab0f5afeeULL, 0xade2626c292a2a9fULL},
+    {0xe848ff06d72a9252ULL, 0xf8be2d3d6ce206b0ULL, 0xd84fc5f798c1a55eULL, 0xc35abe5cebab1ba4ULL},
+    {0xb0dd0edb19af078cULL, 0xee1d857a675ca074ULL, 0x60ef7116e6f3c1e0ULL, 0x7c25b2c3282fb730ULL},
+    {0xb51a19064886308aULL, 0x6b590805d407e77eULL, 0x57059d3707ee283aULL, 0x6298f48fa13cc12fULL},
+    {0x4f1102acb29c3230ULL, 0xcf69cee6182fa164ULL, 0x1780be415c86b5d5ULL, 0xab5d0760d1fe77dcULL},
+    {0xc639b7c24b26ef11ULL, 0xa57d650a8007d505ULL, 0xd81275131f4f91f8ULL, 0x10000e5f7bf7a58bULL},
+    {0x295b23eaa04478edULL, 0xf1d3279f36823213ULL, 0x743eedc2ede6d478ULL, 0x09d89163f581d1e0ULL},
+    {0xc04b4f9c5d26c200ULL, 0x69e6e6e431a2d40bULL, 0x4823b45b89dc689cULL, 0xf567382197055bf0ULL},
+    {0x09f16c9da06c8a66ULL, 0xf32c270b20ce5f38ULL, 0xbe61763d20685d37ULL, 0xda01b157a2b021e9ULL},
+    {0xc6d70a8c6aec7778ULL, 0xaccd356978aafc8eULL, 0xa1fbf40a9936c15dULL, 0x9d7c0c2cf565896cULL},
+    {0x90c526d9d0b6773fULL, 0x327a229ce1248578ULL, 0xfbdcc8828b2c1889ULL, 0x592056e6bbf026f6ULL},
+    {0xa14aaaccc2890705ULL, 0xe63e390ab5f8a1a5ULL, 0x0fbd392d992b9686ULL, 0x746ea463d01f96a4ULL},
+    {0xd8cd74de1850f135ULL, 0x441424d88baa1859ULL, 0xb4bb676b08602d23ULL, 0x4d1dc582c66946beULL},
+    {0x2adbc6211da0644cULL, 0x994b90f8d7149b3dULL, 0x4b145a211d1fdfdfULL, 0x621c1b93e8fa1183ULL},
+    {0x2fd0c3d604d53cdfULL, 0x340889c14a3c5736ULL, 0x7bd5128045929790ULL, 0xfaf3fe8684e4e611ULL},
+    {0x01e53e1bc659d517ULL, 0x5f15699d4848bfccULL, 0x6d8bf975dcc01074ULL, 0x4a55ccb047f7ed1fULL},
+    {0x71ce8d56b9692c38ULL, 0x629372507db35e61ULL, 0xefcb70ac050d5190ULL, 0x929a14fdb0efb0b5ULL},
+    {0x27d627035f8c74a5ULL, 0xe890fcbab799d186ULL, 0xde5841dcae8e37bbULL, 0xcf9e9a1026630265ULL},
+    {0xb405010a26f11c18ULL, 0xfd3a5a8b24565256ULL, 0x9d53ec478a607c58ULL, 0xbfbcf2e3dee7abfaULL},
+    {0xb072a316838de4eeULL, 0x8f148500f69fe8f8ULL, 0xbc2ad4d4d5a4ecb8ULL, 0x20d9430de74248c9ULL},
+    {0x732bd9e5c94b916aULL, 0xa0851e63a9ec247cULL, 0x63eb42892a0f4361ULL, 0x6db40995b68e4c68ULL},
+    {0xe87d88258b7992ceULL, 0xb38ada6d1a5427baULL, 0x29f4387fbb3eebe2ULL, 0x08543e7ab4077f43ULL},
+    {0x6735bb34738c34f7ULL, 0x0a1db90231a55a32ULL, 0x7f05b87543072eb8ULL, 0x2281c456455c4a6dULL},
+    {0x053ff7e4e8581163ULL, 0x0b4df9e68366344aULL, 0x259022fe05f4023eULL, 0x2432aaa71d816e63ULL},
+    {0xfc89e47923390d01ULL, 0x81690de70406c5b2ULL, 0xdcdf361320fa2c0bULL, 0x065e8192b0d9e2abULL},
+    {0x54ae81c77079738dULL, 0xe3da1faabf2f681dULL, 0xfac68c11fe1e596cULL, 0x6f46880c9915650eULL},
+    {0x9350f3f8897dc5ccULL, 0x3ac1fea4d54d0710ULL, 0x70f4ef60d5dd3890ULL, 0x8de6f3aa90cec548ULL},
+    {0xe7b23f10622b3386ULL, 0xc22f28a3d0afc80bULL, 0xcb5512bde4e7bf59ULL, 0xf930e902851defa3ULL},
+    {0xcaefa30f55ce5c0fULL, 0x7bf0fe15bdc9337fULL, 0x7a55e55bbd72fb81ULL, 0xb05640b794289f31ULL},
+    {0x30121e7a60194d6aULL, 0xb8b27bb7572d2871ULL, 0x61d6cf653e616a08ULL, 0x0fa65f166fbb0db4ULL},
+    {0x646fe4bfa600d564ULL, 0x3444a78d93dffc9aULL, 0x1c46fb7ea0484857ULL, 0x7a974830be953c4aULL},
+    {0x0ffabb6c5ce8d644ULL, 0xbe489e3f8ac41534ULL, 0xb8f35b514eb14767ULL, 0x7691957a691df817ULL},
+    {0x5b16024d0563a65aULL, 0x83f997e75e88067fULL, 0xa9c11c5aaf2cab97ULL, 0x57f44892a2ad86eaULL},
+    {0xa6c7eee290c62375ULL, 0x7fe5c232f064f464ULL, 0x947c9b3af027e791ULL, 0x6062e8c7dc309cb2ULL},
+    {0x038e07e40a2812e1ULL, 0x52a29a371c84710fULL, 0x4c5bac1c57856ed7ULL, 0x2629bab11c98b6aeULL},
+    {0x637242c48b99b633ULL, 0x3e3494a05f161ecdULL, 0xc3f6fbf07e464327ULL, 0xaaa38210dde97c64ULL},
+    {0xc4d01c7eb078fd29ULL, 0xc188ca2c76798705ULL, 0x81d165297d239d2aULL, 0xd6e3b368fb2a3110ULL},
+    {0x7f90ffb775c02726ULL, 0xacfe2b03b09803d0ULL, 0x5a70368075759194ULL, 0x6309de7dbb3bf59dULL},
+    {0xf0f03027dfdc22d5ULL, 0x902b0ee66222acc7ULL, 0x78a3e873f00291edULL, 0xdb9d6b2d354321b4ULL},
+    {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL},
+    {0x85d1837e6f0cd3feULL, 0xa4b0488571edcb9dULL, 0xe9edb73cb3e9fb7cULL, 0xba70f1bd97fc40b0ULL},
+    {0xac54fa504c60e306ULL, 0x0b893c16e4a7f3b3ULL, 0xaff90eda09ea8b4cULL, 0x3727c275522644a7ULL},
+    {0x302eda308643ab47ULL, 0xc9a202b2322bb7f6ULL, 0xd4483ff9a9ac5a23ULL, 0x574e4d0093e3a2e4ULL},
+    {0x261882d92ec8429fULL, 0xabfffe7ac9ea1612ULL, 0x236417db3b031424ULL, 0xec6aa16a8ffc76faULL},
+    {0x52f6a62700009087ULL, 0xf7c39d8fc76906a3ULL, 0x285943d7fb75d765ULL, 0x88e5349d50f3ddefULL},
+    {0x3facc68ed0053ac4ULL, 0xfc0c646fb82afcebULL, 0xf055378c576c5c9aULL, 0x21588c86cc534c29ULL},
+    {0xfe596054913ed407ULL, 0x3d38ff4fc965c1faULL, 0x776751b126655d13ULL, 0x443c1363fd5c7d43ULL},
+    {0x1a672a03c71adc2eULL, 0x6217b3306e3e9557ULL, 0x163160efcad9c046ULL, 0x5243e79672334390ULL},
+    {0x58ce1e7d6ea9281fULL, 0x5348b64c107873b6ULL, 0xdabe97e1dd9a59c1ULL, 0x2dcec71c419baa62ULL},
+    {0x955659c7b8793ecfULL, 0x37fae57370f8bc19ULL, 0xfba1683b54b1e0f6ULL, 0xe91553475948d23eULL},
+    {0xbb5b5c8aa1ad89e1ULL, 0x9d7c00c8471ddc07ULL, 0xa910bdeff21ce218ULL, 0x540fca0570720eb7ULL},
+    {0x0612914f1b46c912ULL, 0x6d8abce0cf641cfcULL, 0x32f22fb19ac4550bULL, 0xc4b65c3551c83c69ULL},
+    {0x536e6114e4189cfcULL, 0xbe100596c8da9541ULL, 0xee7eb44f2fdbd1b8ULL, 0xb1170d0754beeaa4ULL},
+    {0xbeb789dbbc4ea209ULL, 0x267d7103ef9f83a3ULL, 0x93f548c2cab0a32cULL, 0x45cac579389af5caULL},
+    {0x65ceb6cde220e757ULL, 0xd6f9074a4c2732f7ULL, 0xa8e0425b0d01cd1eULL, 0x2b75c5d185461341ULL},
+    {0xafbacb099d1967bdULL, 0x1af87374102c1031ULL, 0x470868184fcc3f5fULL, 0x114dcbb43b155057ULL},
+    {0x5f98e9b5ad62427dULL, 0xf27e722d27743cd9ULL, 0x7ebe95d47cd1daf2ULL, 0x1b98494373c20b8aULL},
+    {0x8f1d0f5ec26521a6ULL, 0x036e9886f63c9933ULL, 0x4ac6fab0688e4ccdULL, 0x93d03eea25d1d816ULL},
+    {0xdd4e745e4412a26aULL, 0xbb62b24404a1be96ULL, 0x9c227b5ba376faeeULL, 0x08615908bcc4c8f2ULL},
+    {0xebe0d315a9cb279bULL, 0xc7a967d45d82bbcaULL, 0x64d85cc844957794ULL, 0xf6a1ef6a7d3b2545ULL},
+    {0x29bfb1bdc678fcbeULL, 0x611e5aedd44a4fd4ULL, 0xd188547deb3f0136ULL, 0x2b8dd348e0f767aeULL},
+    {0xfad25fa87d091580ULL, 0x5154a018eba8e309ULL, 0xbd9b522fb9f15d0bULL, 0xfcd653bc999d276bULL},
+    {0x29c79a4cedb3baf2ULL, 0x946592914b67e34fULL, 0x04921932aaf82150ULL, 0xb36394657868f06eULL},
+    {0x6cbfcd64bf69402cULL, 0xca9a2b49a6e6b16dULL, 0xba835279ffb6a358ULL, 0xfbdf21da0bb9add0ULL},
+    {0x23436782d086ca23ULL, 0x0cf66f05d413a46dULL, 0xbb90914a9c9871a3ULL, 0xedcce16aeb59e5adULL},
+    {0x130e23fa572004a9ULL, 0xf9ce20dec18c4b44ULL, 0x5cea7b8a1ac11de9ULL, 0x6608d757c7d36be3ULL},
+    {0x70c7a48f09b95bb9ULL, 0xd03a1ed309668f2fULL, 0xa955e448a10873d4ULL, 0xd5d4c6699513858fULL},
+    {0x72015cf80ce336f4ULL, 0x619c9d98f6f33bcbULL, 0x59f1b7e5d5fbfdc3ULL, 0x16cac53fc2905146ULL},
+    {0x5f340fcb5be19401ULL, 0xce2129cd34ae493aULL, 0x14690cfa36c329edULL, 0xc6e96787aedc5c40ULL},
+    {0x7ad9f632881e960fULL, 0xb8052dcca0e13395ULL, 0xd457241f6a9863acULL, 0xf8d2e75e66d53d83ULL},
+    {0x23336699f63c8e45ULL, 0x33b2e33e1d4e5bdbULL, 0x37fdeee585fdcd8eULL, 0x9a5144da7f765fd8ULL},
+    {0x0c7840cbc3b121adULL, 0xd317530723ab526aULL, 0xf31d2e03157bc387ULL, 0xa2b5d83a373c7ac2ULL},
+    {0x47b3063d7d254e4cULL, 0xea7c37e6ee511ddfULL, 0x0b50e1ab78926eefULL, 0x3ff3ff3e9168fd71ULL},
+    {0x2c56cd0f48e4587dULL, 0x4c77464d80c69c23ULL, 0xcbbf60dca92d32deULL, 0x6021ef776e85bae8ULL},
+    {0xe3521a7cbf37c2a1ULL, 0xa5130e508b35bcf2ULL, 0xf308dc3d84a999f1ULL, 0x601a299a0bbe06e1ULL},
+    {0xde3439ebd3e4fcefULL, 0x5b1dcb68d8e77159ULL, 0xb00b42e8b528bff6ULL, 0x9b121812c345eb87ULL},
+    {0x07eb2f053805555cULL, 0xa7f205f341a367e5ULL, 0x5d5d85d95fc59359ULL, 0x057f094f242a8701ULL},
+    {0x2e990fa0b86f494dULL, 0x5d3d62bea3d0c982ULL, 0x2be3af695f4ca02dULL, 0xcc92a4a3521dba28ULL},
+    {0xdd8082fb069d5ee7ULL, 0x7dc029224f1676fbULL, 0x65e7ab91abe659d0ULL, 0x04fb453c7ad02c02ULL},
+    {0x90b632d403b4513cULL, 0x0f186a740aaa16b5ULL, 0xb93a0637f3af87f7ULL, 0x3910377fe08e48a3ULL},
+    {0xcafe235cd7fe7ef0ULL, 0x5f1e003e1d3a7dafULL, 0x7f5505759890b722ULL, 0xf2f7c89f1379cf05ULL},
+    {0x5a252ed34d09cd4fULL, 0xe8f150b98011d5feULL, 0x131bf6c475e29db1ULL, 0x07818fb0f5b0ff11ULL},
+    {0x0441124ba35b2f58ULL, 0x9d4b489eae71f97dULL, 0x50fa45528d32be3aULL, 0xce8349b10acdabcaULL},
+    {0xade4816bccf327acULL, 0xc14a5bff8ad78a52ULL, 0x4cc84cfe14a77c57ULL, 0x183c124cf3d64e0bULL},
+    {0x4dbeffc02ebf0904ULL, 0xc3b545955dbab803ULL, 0xb7fa51c1fe79c53bULL, 0x688b6947de87d7e9ULL},
+    {0x2f5b386d0a416de5ULL, 0xdd87232f5cca256aULL, 0x7ba82a958b9e6a9aULL, 0x2c55c09810b2f548ULL},
+    {0xf75f6b5cec404580ULL, 0x8f0aa8baea9011fdULL, 0x1221c7c14b1db112ULL, 0x1d8ee30bc2f88017ULL},
+    {0xd18562b8cfa0694fULL, 0xba5487bfcecce199ULL, 0xde5eb81978735ad0ULL, 0x33a1c005e4ccc286ULL},
+    {0xdca75eca4474cbe5ULL, 0x0388cd9f71f314e3ULL, 0xd4699ceb082644c3ULL, 0x1271254993f074aaULL},
+    {0x1c493fa07fa74dcdULL, 0xb59cd5fcb429c2a9ULL, 0x3e550b09e8493d84ULL, 0x516fabbf03d78293ULL},
+    {0xe6d4233d77a1930dULL, 0x00424fa384fbe6eeULL, 0x4c636e19b68da5afULL, 0x140c9813f8542a71ULL},
+    {0xbea7da1e4eabfb2cULL, 0x271441e275aceb6bULL, 0x00ef11ecb78fd7ddULL, 0x3564fd80ea4578c1ULL},
+    {0xaf64e36a267033fdULL, 0xb86eb7a249850b0fULL, 0x9a888e9f318a8efeULL, 0x734c58deea6bd24bULL},
+    {0x30765a1ca7975996ULL, 0xeb222e5b91776decULL, 0x27e74ceb6b5c8a44ULL, 0xaea3b00f90869cf7ULL},
+    {0xc41171736f6127bdULL, 0xbbe041e1a6089bafULL, 0x623b0619adb26e6bULL, 0xc119ec86604ac1deULL},
+    {0xcc48029f3903aa23ULL, 0xddf1854fc56579d8ULL, 0xaa69f6bbf9bfebccULL, 0xfc1385169b03eb72ULL},
+    {0x409b2e169eb1bbfaULL, 0x771b06055d169793ULL, 0x47bf1babcb2b82f5ULL, 0xace055588e22fd26ULL},
+    {0x01731918ee54abd6ULL, 0x759a7ec7f27f3792ULL, 0xb4d6164f3e9d573eULL, 0xb604b97729a3c214ULL},
+    {0x1a22142b7cc54bcfULL, 0x43461d4569c23fa4ULL, 0x8d7ff0d4f4fb9470ULL, 0x1a825a9fac612b54ULL},
+    {0x39da610606e0e771ULL, 0x4566a69758dd856dULL, 0x1c60396a2c51aa0bULL, 0xf418b6ce5a857da3ULL},
+    {0xdfca68648b28c5afULL, 0xb56437fb2b753802ULL, 0xebb82aacdf6ca80dULL, 0xa170e108788db093ULL},
+    {0xde5b821c4a3d86e8ULL, 0x861fffe004c85acaULL, 0x3413838181a6096fULL, 0x460de3bdbe1cb3acULL},
+    {0x5b7b491f49ccffccULL, 0xae7f8689b0bbd6a0ULL, 0x13865b737d9739bcULL, 0x6c132e0c5374c916ULL},
+}};
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr bool check_jump_polynomials(std::size_t k) {
+    auto const square = poly_mulmod(JUMP_POLYNOMIALS[k], JUMP_POLYNOMIALS[k]);
+    for(std::size_t i = 0; i < square.size(); ++i) {
+        if(square[i] != JUMP_POLYNOMIALS[k + 1][i]) { return false; }
+    }
+    return true;
+}
+
+static_assert(check_jump_polynomials(0));
+} /* namespace detail */
+
 class Xoshiro256pp {
     // Suppress magic number linter errors (a lot of that in here and that is normal for a RNG)
 public:
     using result_type = uint64_t;
 
 private:
+    template<std::size_t Lanes>
+    friend class Xoshiro256ppSimd;
+
     std::array<result_type, 4> s{};
 
     static inline result_type rotl(result_type x, unsigned k) {
@@ -38,13 +239,13 @@ private:
         s[3] = rotl(s[3], 45U);
     }
 
-    void jump() {
-        static constexpr std::array JUMP = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    // t = poly(A) * s, where A is the transition matrix of advance()
+    void applyPolynomial(detail::jump_poly_t const & poly) {
         static constexpr unsigned RESULT_TYPE_WIDTH = 64;
         std::array<result_type, 4> t{};
-        for(auto jump : JUMP) {
+        for(auto word : poly) {
             for(unsigned b = 0; b < RESULT_TYPE_WIDTH; b++) {
-                if((jump & UINT64_C(1) << b) != 0) {
+                if((word & UINT64_C(1) << b) != 0) {
                     t[0] ^= s[0];
                     t[1] ^= s[1];
                     t[2] ^= s[2];
@@ -56,6 +257,21 @@ private:
         std::copy(t.begin(), t.end(), s.begin());
     }
 
+    // advance by n * 2^(128 + first) steps
+    void jumpPower(uint64_t n, unsigned first) {
+        static constexpr unsigned RESULT_TYPE_WIDTH = 64;
+        if(n == 0) { return; }
+        unsigned b = 0;
+        while((n >> b & 1U) == 0) { ++b; }
+        auto poly = detail::JUMP_POLYNOMIALS[first + b];
+        while(++b < RESULT_TYPE_WIDTH) {
+            if((n & UINT64_C(1) << b) != 0) {
+                poly = detail::poly_mulmod(poly, detail::JUMP_POLYNOMIALS[first + b]);
+            }
+        }
+        applyPolynomial(poly);
+    }
+
 public:
     explicit Xoshiro256pp(result_type seed) noexcept {
         auto next_seed = [x = seed]() mutable {
@@ -79,6 +295,44 @@ public:
         return result;
     }
 
+    // same values as n consecutive calls to operator(), but state is kept in registers
+    void fill(result_type * out, std::size_t n) noexcept {
+        auto s0 = s[0];
+        auto s1 = s[1];
+        auto s2 = s[2];
+        auto s3 = s[3];
+        for(std::size_t i = 0; i < n; ++i) {
+            out[i] = rotl(s0 + s3, 23) + s0;
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            auto const t = s1 << 17U;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            s3 = rotl(s3, 45U);
+        }
+        s = {s0, s1, s2, s3};
+    }
+
+    template<typename Container>
+    void fill(Container & cont) noexcept {
+        static_assert(std::is_same_v<std::remove_reference_t<decltype(*std::data(cont))>, result_type>);
+        fill(std::data(cont), std::size(cont));
+    }
+
+    // same as n calls to jump(), i.e. advances by n * 2^128 steps, in O(log n) polynomial multiplications
+    void jump(uint64_t n = 1) noexcept {
+        jumpPower(n, 0);
+    }
+
+    // advances by n * 2^192 steps, one long jump is 2^64 jumps
+    void longJump(uint64_t n = 1) noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        jumpPower(n, 64);
+    }
+
     [[nodiscard]] Xoshiro256pp fork() noexcept {
         auto const result = *this;
         jump();
@@ -94,6 +348,115 @@ public:
     }
 };
 
+/* Lanes independent xoshiro256++ streams advanced together. State is kept as struct-of-arrays
+ * so every step is a sequence of lane-wise loops which compiler turns into vector instructions.
+ * Lane i starts where i-th fork() of Xoshiro256pp{seed} would, so lanes never overlap.
+ * Output is lane-interleaved: k-th word of every lane, then (k+1)-th and so on.
+ * Values depend only on seed and Lanes. */
+template<std::size_t Lanes = 4>
+class Xoshiro256ppSimd {
+    static_assert(Lanes > 0 && (Lanes & (Lanes - 1)) == 0, "number of lanes should be power of two");
+
+public:
+    using result_type = uint64_t;
+
+private:
+    using lanes_t = std::array<result_type, Lanes>;
+    using state_t = std::array<lanes_t, 4>;
+    state_t s{};
+    lanes_t buffer{};
+    std::size_t buffered{0};
+
+    static void step(state_t & state, result_type * out) noexcept {
+        auto & [s0, s1, s2, s3] = state;
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            out[l] = Xoshiro256pp::rotl(s0[l] + s3[l], 23) + s0[l];
+        }
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            auto const t = s1[l] << 17U;
+            s2[l] ^= s0[l];
+            s3[l] ^= s1[l];
+            s1[l] ^= s2[l];
+            s0[l] ^= s3[l];
+            s2[l] ^= t;
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            s3[l] = Xoshiro256pp::rotl(s3[l], 45U);
+        }
+    }
+
+    void setLane(std::size_t l, Xoshiro256pp const & gen) noexcept {
+        for(std::size_t k = 0; k < s.size(); ++k) {
+            s[k][l] = gen.s[k];
+        }
+    }
+
+    [[nodiscard]] Xoshiro256pp getLane(std::size_t l) const noexcept {
+        Xoshiro256pp gen{0};
+        for(std::size_t k = 0; k < s.size(); ++k) {
+            gen.s[k] = s[k][l];
+        }
+        return gen;
+    }
+
+public:
+    explicit Xoshiro256ppSimd(result_type seed) noexcept {
+        Xoshiro256pp gen{seed};
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            setLane(l, gen.fork());
+        }
+    }
+
+    [[nodiscard]] result_type operator()() noexcept {
+        if(buffered == 0) {
+            step(s, buffer.data());
+            buffered = Lanes;
+        }
+        return buffer[Lanes - buffered--];
+    }
+
+    // same values as n consecutive calls to operator()
+    void fill(result_type * out, std::size_t n) noexcept {
+        for(; buffered > 0 && n > 0; --n) {
+            *out++ = buffer[Lanes - buffered--];
+        }
+        auto state = s; // local copy can not alias with out
+        for(; n >= Lanes; n -= Lanes, out += Lanes) {
+            step(state, out);
+        }
+        s = state;
+        for(; n > 0; --n) {
+            *out++ = (*this)();
+        }
+    }
+
+    template<typename Container>
+    void fill(Container & cont) noexcept {
+        static_assert(std::is_same_v<std::remove_reference_t<decltype(*std::data(cont))>, result_type>);
+        fill(std::data(cont), std::size(cont));
+    }
+
+    // every lane jumps over the streams of all lanes, so forked generator does not overlap with this one
+    [[nodiscard]] Xoshiro256ppSimd fork() noexcept {
+        auto const result = *this;
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            auto gen = getLane(l);
+            gen.jump(Lanes);
+            setLane(l, gen);
+        }
+        buffered = 0;
+        return result;
+    }
+
+    static constexpr result_type max() {
+        return UINT64_MAX;
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+};
+
 using gen_type = Xoshiro256pp;
 
 template<typename T>
@@ -129,6 +492,11 @@ public:
         return (*gen)();
     }
 
+    template<typename U = T>
+    auto fill(typename U::result_type * out, std::size_t n) noexcept -> decltype(std::declval<U &>().fill(out, n)) {
+        return gen->fill(out, n);
+    }
+
     T & generator() {
         return *gen;
     }
@@ -156,12 +524,96 @@ public:
 template<typename T>
 inline constexpr bool is_generating_v = is_generating<T>::value; //NOLINT(readability-identifier-naming)
 
+enum class Sampling {
+    LEMIRE,       // unbiased multiply-shift with rejection, default
+    LEGACY_MODULO // gen() % range, use it to reproduce tests generated with older versions
+};
+
+namespace detail {
+// atomic, because it is read by tests generated in parallel; relaxed, as it only has to be set before they start
+inline std::atomic<Sampling> sampling{Sampling::LEMIRE}; //NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename Gen, typename = void>
+struct has_fill : std::false_type {}; //NOLINT(readability-identifier-naming)
+
+template<typename Gen>
+struct has_fill<Gen, std::void_t<decltype(std::declval<Gen &>().fill(std::declval<uint64_t *>(), std::size_t{}))>> : std::true_type {};
+
+template<typename Gen>
+inline constexpr bool has_fill_v = has_fill<std::remove_reference_t<Gen>>::value; //NOLINT(readability-identifier-naming)
+
+// words are drawn in blocks of this size when generator supports bulk generation
+constexpr std::size_t FILL_BLOCK = 256;
+
+/* Calls fun(word) on consecutive words of gen until it accepted (returned true) n of them.
+ * Never draws more words than were consumed, so gen ends in the same state as if words were drawn one by one. */
+template<typename Gen, typename Fun>
+void consume_words(Gen && gen, std::size_t n, Fun && fun) {
+    std::array<uint64_t, FILL_BLOCK> words; //NOLINT(cppcoreguidelines-pro-type-member-init, hicpp-member-init)
+    while(n > 0) {
+        auto const cnt = std::min(n, words.size());
+        gen.fill(words.data(), cnt);
+        for(std::size_t i = 0; i < cnt; ++i) {
+            if(fun(words[i])) { --n; }
+        }
+    }
+}
+
+__extension__ using uint128_t = unsigned __int128;
+
+/* Lemire's multiply-shift: res = word * range / 2^w, where w = 32 (high half of word) for small ranges and 64 otherwise.
+ * Unbiased as long as accepted low parts form a window of length 2^w - (2^w mod range). Window is
+ * [0, 2^w - t) instead of [t, 2^w) as in the paper, so word 0 is never rejected. Division is needed only
+ * when low part lands in the last 'range' values, i.e. almost never. Range 0 means 2^64. */
+inline bool lemire_map(uint64_t word, uint64_t range, uint64_t & res) noexcept {
+    constexpr uint64_t HALF = UINT64_C(1) << 32U;
+    if(range == 0) {
+        res = word;
+        return true;
+    }
+    if(range <= HALF) {
+        auto const m = (word >> 32U) * range;
+        auto const low = m & (HALF - 1);
+        res = m >> 32U;
+        auto const limit = HALF - range;
+        return low < limit || low < HALF - (limit % range);
+    }
+    auto const m = static_cast<uint128_t>(word) * range;
+    auto const low = static_cast<uint64_t>(m);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    res = static_cast<uint64_t>(m >> 64U);
+    auto const limit = -range; // 2^64 - range
+    return low < limit || low <= ~(limit % range);
+}
+} /* namespace detail */
+
+inline void setSampling(Sampling sampling) noexcept {
+    detail::sampling.store(sampling, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline Sampling getSampling() noexcept {
+    return detail::sampling.load(std::memory_order_relaxed);
+}
+
 template<typename T>
 struct uni_dist {
 private:
     static_assert(std::is_integral_v<T>);
+    using unsigned_t = std::make_unsigned_t<T>;
     T begin, end;
 
+    // number of values in [begin:end], 0 means 2^64
+    static uint64_t width(T begin, T end) {
+        return static_cast<uint64_t>(static_cast<unsigned_t>(static_cast<unsigned_t>(end) - static_cast<unsigned_t>(begin))) + 1;
+    }
+
+    static bool sample(uint64_t word, T begin, uint64_t range, T & res) {
+        uint64_t offset{};
+        auto const accepted = detail::lemire_map(word, range, offset);
+        res = static_cast<T>(static_cast<unsigned_t>(static_cast<unsigned_t>(begin) + static_cast<unsigned_t>(offset)));
+        return accepted;
+    }
+
 public:
     uni_dist(T begin, T end) :
       begin(begin), end(end) {
@@ -175,8 +627,112 @@ public:
 
     template<typename Gen>
     static T gen(T begin, T end, Gen && gen) {
-        auto const range = end - begin + 1;
-        return (gen() % range) + begin; // not really uniform, but close enough
+        if(getSampling() == Sampling::LEGACY_MODULO) {
+            auto const range = end - begin + 1;
+            return (gen() % range) + begin; // not really uniform, but close enough
+        }
+        auto const range = width(begin, end);
+        T res{};
+        while(!sample(static_cast<uint64_t>(gen()), begin, range, res)) {}
+        return res;
+    }
+
+    template<typename Gen>
+    void fill(T * out, std::size_t n, Gen && gen) const {
+        uni_dist::fill(begin, end, out, n, std::forward<Gen>(gen));
+    }
+
+    // same values as n consecutive calls to gen(begin, end, gen)
+    template<typename Gen>
+    static void fill(T begin, T end, T * out, std::size_t n, Gen && gen) {
+        if constexpr(detail::has_fill_v<Gen>) {
+            if(getSampling() == Sampling::LEGACY_MODULO) {
+                auto const range = end - begin + 1;
+                detail::consume_words(gen, n, [&](uint64_t word) {
+                    *out++ = (word % range) + begin;
+                    return true;
+                });
+            } else {
+                auto const range = width(begin, end);
+                detail::consume_words(gen, n, [&](uint64_t word) {
+                    if(!sample(word, begin, range, *out)) { return false; }
+                    ++out;
+                    return true;
+                });
+            }
+        } else {
+            std::generate_n(out, n, [&] { return uni_dist::gen(begin, end, gen); });
+        }
+    }
+};
+
+/* Index i from [0, n) drawn with probability weights[i] / (sum of weights), exactly.
+ * Integer alias table (Walker, Vose): O(n) construction, then one uniform word per sample,
+ * which picks both the column and the threshold. Requires n * (sum of weights) < 2^64. */
+class discrete_dist { //NOLINT(readability-identifier-naming)
+    std::vector<uint64_t> threshold;
+    std::vector<uint> alias;
+    uint64_t total{0};
+
+    [[nodiscard]] uint column(uint64_t k) const noexcept {
+        auto const i = static_cast<uint>(k / total);
+        return k % total < threshold[i] ? i : alias[i];
+    }
+
+public:
+    explicit discrete_dist(std::vector<uint64_t> const & weights) :
+      threshold(weights.size()), alias(weights.size()) {
+        auto const n = weights.size();
+        assume(n >= 1);
+        for(auto w : weights) {
+            total += w;
+        }
+        assume(total >= 1 && total <= UINT64_MAX / n);
+        // column i holds total units, weight w is scaled to w * n units
+        std::vector<uint> small;
+        std::vector<uint> large;
+        for(uint i = 0; i < n; ++i) {
+            threshold[i] = weights[i] * n;
+            alias[i] = i;
+            (threshold[i] < total ? small : large).push_back(i);
+        }
+        while(!small.empty() && !large.empty()) {
+            auto const s = small.back();
+            small.pop_back();
+            auto const l = large.back();
+            alias[s] = l;
+            threshold[l] -= total - threshold[s];
+            if(threshold[l] < total) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        for(auto i : large) {
+            threshold[i] = total;
+        }
+    }
+
+    template<typename Gen>
+    uint operator()(Gen && gen) const {
+        return column(uni_dist<uint64_t>::gen(0, threshold.size() * total - 1, std::forward<Gen>(gen)));
+    }
+
+    // same values as n consecutive calls to operator()
+    template<typename Gen>
+    void fill(uint * out, std::size_t n, Gen && gen) const {
+        constexpr std::size_t BLOCK = 256;
+        std::array<uint64_t, BLOCK> words{};
+        for(std::size_t done = 0; done < n; done += BLOCK) {
+            auto const count = std::min(BLOCK, n - done);
+            uni_dist<uint64_t>::fill(0, threshold.size() * total - 1, words.data(), count, gen);
+            for(std::size_t i = 0; i < count; ++i) {
+                out[done + i] = column(words[i]);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return threshold.size();
     }
 };
 
@@ -193,8 +749,25 @@ void shuffle_sequence(Iter begin, Iter end, Gen && gen) {
     if(begin == end) {
         return;
     }
-    for(auto it = begin; ++it != end;) {
-        detail::iter_swap(it, begin + uni_dist<size_t>(0, std::distance(begin, it))(gen));
+    if constexpr(detail::has_fill_v<Gen>) {
+        // same swaps as below, but words are drawn in blocks
+        std::size_t i = 1;
+        auto const n = static_cast<std::size_t>(std::distance(begin, end));
+        detail::consume_words(gen, n - 1, [&](uint64_t word) {
+            uint64_t j{};
+            if(getSampling() == Sampling::LEGACY_MODULO) {
+                j = word % (i + 1);
+            } else if(!detail::lemire_map(word, i + 1, j)) {
+                return false;
+            }
+            detail::iter_swap(begin + i, begin + j);
+            ++i;
+            return true;
+        });
+    } else {
+        for(auto it = begin; ++it != end;) {
+            detail::iter_swap(it, begin + uni_dist<size_t>(0, std::distance(begin, it))(gen));
+        }
     }
 }
 
@@ -205,6 +778,153 @@ std::vector<uint> get_permutation(int n, gen_type & gen) {
     return V;
 }
 
+namespace detail {
+
+// uniform double in [0, 1) from 53 high bits of word
+inline double to_unit_interval(uint64_t word) {
+    constexpr auto MANTISSA = 53U;
+    return static_cast<double>(word >> (64U - MANTISSA)) * 0x1p-53; // NOLINT(*-magic-numbers)
+}
+
+/* Set of 64-bit indices with open addressing and linear probing in one preallocated array,
+ * for sampling without replacement; capacity is fixed at construction. */
+class IndexSet {
+    static constexpr uint64_t EMPTY = ~uint64_t{0};
+    static constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15; // NOLINT(*-magic-numbers)
+
+    std::vector<uint64_t> slots;
+    uint64_t mask;
+    unsigned shift;
+
+    [[nodiscard]] std::size_t slot(uint64_t key) const noexcept {
+        return static_cast<std::size_t>((key * MULTIPLIER) >> shift);
+    }
+
+public:
+    // at least twice as many slots as elements
+    explicit IndexSet(std::size_t max_size) {
+        unsigned bits = 1;
+        while((std::size_t{1} << bits) < 2 * max_size) {
+            ++bits;
+        }
+        slots.assign(std::size_t{1} << bits, EMPTY);
+        mask = slots.size() - 1;
+        shift = 64U - bits;
+    }
+
+    // returns false if key was already present
+    bool insert(uint64_t key) {
+        for(auto i = slot(key);; i = (i + 1) & mask) {
+            if(slots[i] == key) { return false; }
+            if(slots[i] == EMPTY) {
+                slots[i] = key;
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] bool contains(uint64_t key) const {
+        for(auto i = slot(key);; i = (i + 1) & mask) {
+            if(slots[i] == key) { return true; }
+            if(slots[i] == EMPTY) { return false; }
+        }
+    }
+
+    // returns false if key was not present; backward shift deletion, so no tombstones are left
+    bool erase(uint64_t key) {
+        auto i = slot(key);
+        for(; slots[i] != key; i = (i + 1) & mask) {
+            if(slots[i] == EMPTY) { return false; }
+        }
+        // entry at j may fill hole at i if its home slot is not in (i, j]
+        for(auto j = (i + 1) & mask; slots[j] != EMPTY; j = (j + 1) & mask) {
+            if(((j - slot(slots[j])) & mask) >= ((j - i) & mask)) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i] = EMPTY;
+        return true;
+    }
+};
+
+// calls fun(k) for every k from [0, N) independently with probability p, in increasing order
+// geometric skipping (Batagelj, Brandes 2005), expected O(pN + 1) time
+template<typename Fun>
+void bernoulli_indices(uint64_t N, double p, gen_type & gen, Fun && fun) {
+    if(p <= 0) { return; }
+    if(p >= 1) {
+        for(uint64_t k = 0; k < N; ++k) {
+            fun(k);
+        }
+        return;
+    }
+    auto const log_q = std::log1p(-p);
+    for(uint64_t k = 0; k < N; ++k) {
+        auto const skip = std::floor(std::log1p(-to_unit_interval(gen())) / log_q);
+        if(skip >= static_cast<double>(N - k)) { return; }
+        auto const s = static_cast<uint64_t>(skip);
+        if(s >= N - k) { return; }
+        k += s;
+        fun(k);
+    }
+}
+
+// calls fun(k) for m distinct k from [0, N) chosen uniformly, in increasing order, expected O(m) time:
+// Bernoulli sample of slightly bigger expected size is drawn by geometric skipping (redrawn in rare
+// case it is too small), then uniformly chosen surplus is dropped; memory access is sequential
+template<typename Fun>
+void sample_indices(uint64_t N, uint64_t m, gen_type & gen, Fun && fun) {
+    assume(m <= N);
+    if(m == 0) { return; }
+    auto const expected = static_cast<double>(m) + 3 * std::sqrt(static_cast<double>(m)) + 16; // NOLINT(*-magic-numbers)
+    auto const p = std::min(1.0, expected / static_cast<double>(N));
+    std::vector<uint64_t> sample;
+    sample.reserve(static_cast<std::size_t>(std::min(expected + 3 * std::sqrt(expected), static_cast<double>(N)))); // NOLINT(*-magic-numbers)
+    do {
+        sample.clear();
+        bernoulli_indices(N, p, gen, [&sample](uint64_t k) { sample.push_back(k); });
+    } while(sample.size() < m);
+    // Floyd's algorithm for positions to drop
+    auto const count = sample.size();
+    IndexSet dropped(count - m);
+    for(auto j = m; j < count; ++j) {
+        auto const t = uni_dist<uint64_t>::gen(0, j, gen);
+        if(!dropped.insert(t)) { dropped.insert(j); }
+    }
+    for(std::size_t i = 0; i < count; ++i) {
+        if(!dropped.contains(i)) { fun(sample[i]); }
+    }
+}
+
+// same indices and final state of gen as sample_indices, but O(sqrt(m)) memory: sample is only counted,
+// surplus positions are chosen, then the same sample is drawn again from saved copy of gen, skipping them
+template<typename Fun>
+void sample_indices_replay(uint64_t N, uint64_t m, gen_type & gen, Fun && fun) {
+    assume(m <= N);
+    if(m == 0) { return; }
+    auto const expected = static_cast<double>(m) + 3 * std::sqrt(static_cast<double>(m)) + 16; // NOLINT(*-magic-numbers)
+    auto const p = std::min(1.0, expected / static_cast<double>(N));
+    gen_type start = gen;
+    uint64_t count = 0;
+    do {
+        start = gen;
+        count = 0;
+        bernoulli_indices(N, p, gen, [&count](uint64_t /*unused*/) { ++count; });
+    } while(count < m);
+    IndexSet dropped(count - m);
+    for(auto j = m; j < count; ++j) {
+        auto const t = uni_dist<uint64_t>::gen(0, j, gen);
+        if(!dropped.insert(t)) { dropped.insert(j); }
+    }
+    uint64_t position = 0;
+    bernoulli_indices(N, p, start, [&](uint64_t k) {
+        if(!dropped.contains(position++)) { fun(k); }
+    });
+}
+
+} /* namespace detail */
+
 /* CRTP, assumes Derived has 'generator()' method/field */
 template<typename Derived>
 class RngUtilities {
@@ -234,6 +954,20 @@ public:
     int64_t randLong(int64_t from, int64_t to) {
         return uni_dist<int64_t>::gen(from, to, gen());
     }
+
+    // get n random int32 in [from:to], inclusive
+    std::vector<int32_t> randInts(std::size_t n, int32_t from, int32_t to) {
+        std::vector<int32_t> res(n);
+        uni_dist<int32_t>::fill(from, to, res.data(), n, gen());
+        return res;
+    }
+
+    // get n random int64 in [from:to], inclusive
+    std::vector<int64_t> randLongs(std::size_t n, int64_t from, int64_t to) {
+        std::vector<int64_t> res(n);
+        uni_dist<int64_t>::fill(from, to, res.data(), n, gen());
+        return res;
+    }
 };
 
 } /* namespace test */
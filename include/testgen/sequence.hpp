@@ -2,6 +2,7 @@
 #define TESTGEN_SEQUENCE_HPP_
 
 #include "rand.hpp"
+#include "writer.hpp"
 
 #include <algorithm>
 #include <functional>
@@ -33,6 +34,13 @@ public:
         seqGenerate(*this, std::forward<Gen>(gen));
     }
 
+    // bulk generation of numbers from dist, faster than generating one by one
+    template<typename Gen>
+    Sequence(std::size_t size, uni_dist<T> const & dist, Gen && gen) :
+      std::vector<T>(size) {
+        dist.fill(this->data(), size, std::forward<Gen>(gen));
+    }
+
     Sequence operator+(Sequence const & x) const {
         Sequence res(this->size() + x.size());
         auto const it = std::copy(this->begin(), this->end(), res.begin());
@@ -47,7 +55,27 @@ public:
         return *this;
     }
 
+    template<typename U = T, std::enable_if_t<detail::is_writable_v<U>, int> = 0>
+    friend Writer & operator<<(Writer & s, Sequence const & x) {
+        auto it = x.begin();
+        auto const end = x.end();
+        if(it == end) { return s; }
+        s << *it++;
+        while(it != end) {
+            s << ' ' << *it++;
+        }
+        return s;
+    }
+
+    // integers are formatted with Writer when stream has default format, otherwise by stream
     friend std::ostream & operator<<(std::ostream & s, Sequence const & x) {
+        if constexpr(detail::is_writable_v<T>) {
+            if(detail::has_default_format(s)) {
+                Writer writer{s};
+                writer << x;
+                return s;
+            }
+        }
         auto it = x.begin();
         auto const end = x.end();
         if(it == end) { return s; }
@@ -3,21 +3,84 @@
 
 #include "assumptions.hpp"
 #include "output.hpp"
+#include "parallel.hpp"
 #include "rand.hpp"
 
+#include <functional>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace test {
 
+// test registered with Testing::addTest, passed to its body when it is generated
+template<typename TestcaseT, typename AssumptionsT>
+class DeferredTest : public RngUtilities<DeferredTest<TestcaseT, AssumptionsT>> {
+    std::ostream & output;
+    Writer writer;
+    gen_type & gen;
+    AssumptionsT & assumptions;
+    std::string const & filename;
+    bool assumptions_held{true};
+
+public:
+    DeferredTest(std::ostream & output, gen_type & gen, AssumptionsT & assumptions, std::string const & filename) :
+      output{output}, writer{output}, gen{gen}, assumptions{assumptions}, filename{filename} {}
+
+    GeneratorWrapper<gen_type> generator() {
+        return GeneratorWrapper<gen_type>{gen};
+    }
+
+    [[nodiscard]] std::string const & getFilename() const {
+        return filename;
+    }
+
+    // false if some testcase failed assumptions; it is reported by runTests after all tests are generated
+    [[nodiscard]] bool assumptionsHeld() const {
+        return assumptions_held;
+    }
+
+    template<typename T>
+    auto generateFromSchema(Generating<T> const & schema) {
+        return schema.generate(gen);
+    }
+
+    // formats like Testing::operator<<, but failed assumption does not stop the program here,
+    // as other tests may still be generated on other threads
+    template<typename T>
+    DeferredTest & operator<<(T const & out) {
+        if constexpr(std::is_same_v<T, TestcaseT>) {
+            if(!assumptions.check(out)) {
+                assumptions_held = false;
+            }
+        }
+        if constexpr(is_generating<T>::value) {
+            detail::print(writer, output, generateFromSchema(out));
+        } else {
+            detail::print(writer, output, out);
+        }
+        return *this;
+    }
+};
+
 template<typename TestcaseManagerT, typename TestcaseT = std::false_type, template<typename> typename AssumptionsManagerT = AssumptionManager>
 class Testing : private TestcaseManagerT, public RngUtilities<Testing<TestcaseManagerT, TestcaseT, AssumptionsManagerT>> {
     TestcaseT updateTestcase() {
         output.set(this->stream());
+        writer.set(this->stream());
         return TestcaseT{};
     }
 
+    struct deferred_task {
+        std::string filename;
+        std::function<bool()> run; // false if assumptions failed
+    };
+
     Output output;
+    Writer writer;
     AssumptionsManagerT<TestcaseT> assumptions;
+    std::vector<deferred_task> deferred;
 
 public:
     using TestcaseManagerT::TestcaseManagerT;
@@ -33,23 +96,27 @@ public:
     }
 
     void skipTest() {
+        writer.flush();
         TestcaseManagerT::skipTest();
         assumptions.resetTest();
     }
 
     void nextSuite() {
+        writer.flush();
         TestcaseManagerT::nextSuite();
         assumptions.resetSuite();
         assumptions.resetTest();
     }
 
     TestcaseT getTest() {
+        writer.flush();
         TestcaseManagerT::nextTest();
         assumptions.resetTest();
         return updateTestcase();
     }
 
     void nextTest() {
+        writer.flush();
         TestcaseManagerT::nextTest();
         assumptions.resetTest();
         updateTestcase();
@@ -59,17 +126,64 @@ public:
     // resets suite and test assumptions!
     template<typename T, typename U>
     TestcaseT setTest(T test_nr, U suite) {
+        writer.flush();
         TestcaseManagerT::setTest(test_nr, suite);
         assumptions.resetSuite();
         assumptions.resetTest();
         return updateTestcase();
     }
 
+    /* Registers next test to be generated by runTests. Its generator and assumptions are fixed now,
+     * so output does not depend on number of threads and is the same as if body was run after getTest().
+     * body(t) should only use t, which provides operator<<, generator() and rng utilities.
+     * Test is recorded under its (test, suite) index, so after runTests setTest on it continues it.
+     * Every test checks its own copy of current assumptions, and copies run concurrently: assumptions
+     * should be stateless, as they do not see other tests, and anything they share has to be thread-safe. */
+    template<typename Fun>
+    void addTest(Fun && body) {
+        writer.flush();
+        assumptions.resetTest();
+        auto test = TestcaseManagerT::deferTest();
+        deferred.push_back({test.filename, [test = std::move(test), assumptions = assumptions, body = std::forward<Fun>(body)]() mutable {
+            typename TestcaseManagerT::stream_type stream(test.filename);
+            DeferredTest<TestcaseT, AssumptionsManagerT<TestcaseT>> deferred_test{stream, test.generator, assumptions, test.filename};
+            body(deferred_test);
+            return deferred_test.assumptionsHeld();
+        }});
+    }
+
+    // generates tests registered with addTest, each one to its own stream;
+    // failed assumptions are reported when all tests are written, then program exits like after assume
+    void runTests(unsigned threads = std::thread::hardware_concurrency()) {
+        std::vector<char> held(deferred.size());
+        detail::parallel_for(deferred.size(), threads, [this, &held](std::size_t i) {
+            held[i] = static_cast<char>(deferred[i].run());
+        });
+        bool all_held = true;
+        for(std::size_t i = 0; i < deferred.size(); ++i) {
+            if(held[i] == 0) {
+                std::cerr << "Assumption failed for " << deferred[i].filename << '\n';
+                all_held = false;
+            }
+        }
+        deferred.clear();
+        assume(all_held);
+    }
+
     template<typename T>
     auto generateFromSchema(Generating<T> const & schema) {
         return schema.generate(generator());
     }
 
+    // writes buffered output of current test to its stream, which is otherwise done when test is left
+    void flush() {
+        writer.flush();
+        output.flush();
+    }
+
+    // integers, strings, sequences and graphs are formatted by fast Writer; while stream format is
+    // changed (std::setw, std::hex, ...) all but graphs are formatted by stream, graphs stay decimal;
+    // Writer keeps its buffer until test is left, stream prints something or flush() is called
     template<typename T>
     Testing & operator<<(T const & out) {
         if constexpr(std::is_same_v<T, TestcaseT>) {
@@ -79,9 +193,9 @@ public:
             }
         }
         if constexpr(is_generating<T>::value) {
-            output << generateFromSchema(out);
+            detail::print(writer, output, generateFromSchema(out));
         } else {
-            output << out;
+            detail::print(writer, output, out);
         }
         return *this;
     }
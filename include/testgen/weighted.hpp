@@ -0,0 +1,166 @@
+#ifndef TESTGEN_WEIGHTED_HPP_
+#define TESTGEN_WEIGHTED_HPP_
+
+#include "graph.hpp"
+#include "rand.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace test {
+
+using weight_t = int64_t;
+
+/* Edge list with weights in separate array: weight of edges[i] is weights[i]. Arrays are kept apart,
+ * so generators fill weights in bulk and structure can be generated and relabelled independently,
+ * e.g. WeightedGraph G(Gnm(n, m).generateEdgeList(gen)); uniformWeights(G, 1, 1000, gen); */
+class WeightedGraph {
+    std::size_t n;
+    edge_list_t edges{};
+    std::vector<weight_t> weights{};
+
+public:
+    WeightedGraph() :
+      WeightedGraph(0) {}
+    explicit WeightedGraph(std::size_t n) :
+      n{n} {}
+    // all weights are 0
+    WeightedGraph(std::size_t n, edge_list_t edges) :
+      n{n}, edges{std::move(edges)}, weights(this->edges.size(), 0) {}
+    WeightedGraph(std::size_t n, edge_list_t edges, std::vector<weight_t> weights) :
+      n{n}, edges{std::move(edges)}, weights{std::move(weights)} {
+        assume(this->edges.size() == this->weights.size());
+    }
+    explicit WeightedGraph(EdgeListGraph const & G) :
+      WeightedGraph(G.size(), G.getEdges()) {}
+    explicit WeightedGraph(Graph const & G) :
+      WeightedGraph(G.size(), G.getEdges()) {}
+
+    void addEdge(uint a, uint b, weight_t w) {
+        edges.emplace_back(a, b);
+        weights.push_back(w);
+    }
+
+    // vertex v becomes label[v]
+    void relabel(std::vector<uint> const & label) {
+        for(auto & [a, b] : edges) {
+            a = label[a];
+            b = label[b];
+        }
+    }
+
+    // random labels, random order of edges (weights move with them) and random orientation of each edge
+    void permute(gen_type & gen) {
+        relabel(get_permutation(static_cast<int>(n), gen));
+        auto order = get_permutation(static_cast<int>(edges.size()), gen);
+        for(std::size_t i = 0; i < order.size(); ++i) {
+            while(order[i] != i) {
+                auto const target = order[i];
+                std::swap(edges[i], edges[target]);
+                std::swap(weights[i], weights[target]);
+                std::swap(order[i], order[target]);
+            }
+        }
+        constexpr std::size_t BITS = 64;
+        uint64_t word{};
+        for(std::size_t i = 0; i < edges.size(); ++i) {
+            if(i % BITS == 0) { word = gen(); }
+            if((word >> (i % BITS) & 1U) != 0) {
+                std::swap(edges[i].first, edges[i].second);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return n;
+    }
+
+    [[nodiscard]] edge_list_t const & getEdges() const noexcept {
+        return edges;
+    }
+
+    [[nodiscard]] std::vector<weight_t> const & getWeights() const noexcept {
+        return weights;
+    }
+
+    [[nodiscard]] std::vector<weight_t> & getWeights() noexcept {
+        return weights;
+    }
+
+    // structure without weights
+    [[nodiscard]] Graph toGraph() const {
+        return Graph(n, edges);
+    }
+
+    // structure without weights
+    [[nodiscard]] CsrGraph toCsr() const {
+        return CsrGraph(n, edges);
+    }
+};
+
+// every weight independently uniform from [lo:hi]
+inline void uniformWeights(WeightedGraph & G, weight_t lo, weight_t hi, gen_type & gen) {
+    auto & weights = G.getWeights();
+    uni_dist<weight_t>::fill(lo, hi, weights.data(), weights.size(), gen);
+}
+
+// pairwise distinct weights from [lo:hi], uniformly chosen set in random order, expected O(m)
+inline void distinctWeights(WeightedGraph & G, weight_t lo, weight_t hi, gen_type & gen) {
+    auto & weights = G.getWeights();
+    auto const range = static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1;
+    assume(lo <= hi);
+    if(range == 0) {
+        // whole weight_t, 2^64 values: raw draws are taken in order, rare repeats are redrawn;
+        // IndexSet can not hold ~0, which is tracked apart
+        detail::IndexSet drawn(weights.size());
+        bool drawn_max = false;
+        auto const fresh = [&drawn, &drawn_max](uint64_t k) {
+            return k == ~uint64_t{0} ? !std::exchange(drawn_max, true) : drawn.insert(k);
+        };
+        for(auto & weight : weights) {
+            auto k = gen();
+            while(!fresh(k)) {
+                k = gen();
+            }
+            weight = static_cast<weight_t>(k);
+        }
+        return;
+    }
+    assume(weights.size() <= range);
+    auto it = weights.begin();
+    detail::sample_indices(range, weights.size(), gen, [&it, lo](uint64_t k) {
+        *it++ = static_cast<weight_t>(static_cast<uint64_t>(lo) + k);
+    });
+    shuffle_sequence(weights.begin(), weights.end(), gen);
+}
+
+// weights from [lo:2lo], so sum of any two is at least any third one: triangle inequality holds
+// and every edge is a shortest path between its endpoints
+inline void metricWeights(WeightedGraph & G, weight_t lo, gen_type & gen) {
+    assume(lo >= 1);
+    uniformWeights(G, lo, 2 * lo, gen);
+}
+
+/* Adversarial weights for Dijkstra from vertex 0 which does not skip outdated heap entries:
+ * edge (u, u + 1) gets 1, other edges (u, v), u < v, get 2(n - u). With path 0, 1, ..., n - 1 in graph
+ * dist(u) = u and vertices are popped in order of labels, while every popped u improves distance
+ * of all its neighbours v > u once more, so each vertex is pushed about deg(v) times.
+ * Apply it before random relabelling. */
+inline void antiDijkstraWeights(WeightedGraph & G) {
+    auto const n = static_cast<weight_t>(G.size());
+    auto const & edges = G.getEdges();
+    auto & weights = G.getWeights();
+    for(std::size_t i = 0; i < edges.size(); ++i) {
+        auto const [a, b] = edges[i];
+        auto const u = std::min(a, b);
+        auto const v = std::max(a, b);
+        weights[i] = v == u + 1 ? 1 : 2 * (n - static_cast<weight_t>(u));
+    }
+}
+
+} /* namespace test */
+
+#endif /* TESTGEN_WEIGHTED_HPP_ */
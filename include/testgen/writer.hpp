@@ -0,0 +1,134 @@
+#ifndef TESTGEN_WRITER_HPP_
+#define TESTGEN_WRITER_HPP_
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace test {
+
+/* Buffered output of integers, characters and strings without locale and formatting flags.
+ * Numbers are formatted with std::to_chars straight into owned buffer, which is handed to
+ * target streambuf in one sputn call when full, so file streams write it with a single syscall.
+ * Buffered data is written on flush(), set() and destruction. */
+class Writer {
+public:
+    static constexpr std::size_t BUFFER_SIZE = std::size_t{1} << 16U;
+
+private:
+    static constexpr std::size_t MAX_INTEGER_WIDTH = 24; // sign and 20 digits of 64-bit integer
+
+    std::streambuf * target{nullptr};
+    // not value-initialised, so short-lived writers do not zero 64 KiB each
+    std::unique_ptr<char[]> buffer{new char[BUFFER_SIZE]}; //NOLINT(*-avoid-c-arrays)
+    std::size_t used{0};
+
+    void reserve(std::size_t n) {
+        if(used + n > BUFFER_SIZE) { flush(); }
+    }
+
+    Writer & put(char c) {
+        reserve(1);
+        buffer[used++] = c;
+        return *this;
+    }
+
+public:
+    Writer() = default;
+    explicit Writer(std::ostream & stream) :
+      target{stream.rdbuf()} {}
+    Writer(Writer const &) = delete;
+    Writer(Writer &&) = delete;
+    Writer & operator=(Writer const &) = delete;
+    Writer & operator=(Writer &&) = delete;
+    ~Writer() {
+        flush();
+    }
+
+    // writes buffered data to old stream first
+    void set(std::ostream & stream) {
+        flush();
+        target = stream.rdbuf();
+    }
+
+    void flush() {
+        if(used != 0 && target != nullptr) {
+            target->sputn(buffer.get(), static_cast<std::streamsize>(used));
+        }
+        used = 0;
+    }
+
+    Writer & operator<<(std::string_view str) {
+        if(str.size() > BUFFER_SIZE) {
+            flush();
+            if(target != nullptr) {
+                target->sputn(str.data(), static_cast<std::streamsize>(str.size()));
+            }
+            return *this;
+        }
+        reserve(str.size());
+        std::memcpy(buffer.get() + used, str.data(), str.size());
+        used += str.size();
+        return *this;
+    }
+
+    Writer & operator<<(char const * str) {
+        return *this << std::string_view{str};
+    }
+
+    Writer & operator<<(std::string const & str) {
+        return *this << std::string_view{str};
+    }
+
+    // same text as std::ostream gives with default flags: bool as 0/1, char types as characters;
+    // template also for char, so that floating-point values never convert to it
+    template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    Writer & operator<<(T value) {
+        if constexpr(std::is_same_v<T, bool>) {
+            return put(static_cast<char>('0' + static_cast<int>(value)));
+        } else if constexpr(sizeof(T) == 1) {
+            return put(static_cast<char>(value));
+        } else {
+            reserve(MAX_INTEGER_WIDTH);
+            auto * const begin = buffer.get() + used;
+            used += static_cast<std::size_t>(std::to_chars(begin, begin + MAX_INTEGER_WIDTH, value).ptr - begin);
+            return *this;
+        }
+    }
+};
+
+namespace detail {
+
+template<typename T, typename = void>
+struct is_writable : std::false_type {}; //NOLINT(readability-identifier-naming)
+
+template<typename T>
+struct is_writable<T, std::void_t<decltype(std::declval<Writer &>() << std::declval<T const &>())>> : std::true_type {};
+
+template<typename T, typename = void>
+struct is_ostreamable : std::false_type {}; //NOLINT(readability-identifier-naming)
+
+template<typename T>
+struct is_ostreamable<T, std::void_t<decltype(std::declval<std::ostream &>() << std::declval<T const &>())>> : std::true_type {};
+
+// stream formats integers and strings exactly like Writer: default flags and no field width
+inline bool has_default_format(std::ios_base const & stream) {
+    return stream.flags() == (std::ios_base::skipws | std::ios_base::dec) && stream.width() == 0;
+}
+
+// floating-point values are left to std::ostream, which formats them with its precision
+template<typename T>
+inline constexpr bool is_writable_v = is_writable<T>::value && !std::is_floating_point_v<T>; //NOLINT(readability-identifier-naming)
+
+} /* namespace detail */
+
+} /* namespace test */
+
+#endif /* TESTGEN_WRITER_HPP_ */
@@ -0,0 +1,34 @@
+import json
+import sys
+
+# Compares two JSON files written by 'bench-<name> --json <file>' (or 'make bench-json')
+# usage: bench_compare.py OLD.json NEW.json [THRESHOLD]
+# Prints throughput change of every case present in both files and exits with 1
+# if any case got slower by more than THRESHOLD (default 0.1, i.e. 10%).
+
+OLD_PATH = sys.argv[1]
+NEW_PATH = sys.argv[2]
+THRESHOLD = float(sys.argv[3]) if len(sys.argv) > 3 else 0.1
+
+def load(path):
+    with open(path, 'r') as file:
+        data = json.load(file)
+    return {(r["name"], r["size"]): r for r in data["results"]}
+
+old = load(OLD_PATH)
+new = load(NEW_PATH)
+
+regressions = 0
+for key, result in new.items():
+    if key not in old:
+        continue
+    ratio = result["items_per_second"] / old[key]["items_per_second"]
+    mark = ""
+    if ratio < 1 - THRESHOLD:
+        mark = "  <-- regression"
+        regressions += 1
+    print(f"{key[0]:<40} {key[1]:>10} {ratio:8.3f}x{mark}")
+
+if regressions != 0:
+    print(f"{regressions} regression(s) above {THRESHOLD:.0%}")
+    sys.exit(1)
@@ -0,0 +1,32 @@
+import sys
+
+# Prints table of jump polynomials for xoshiro256 used in include/testgen/rand.hpp.
+# Entry k is x^(2^(FIRST + k)) mod P as four 64-bit words (lowest coefficients first),
+# where P is characteristic polynomial of xoshiro256 transition matrix.
+
+FIRST = 128
+COUNT = 128
+WORD = (1 << 64) - 1
+P = (1 << 256) | 0x0003c03c3f3ecb19_04b4edcf26259f85_0280002bcefd1a5e_9d116f2bb0f0f001
+
+
+def mulmod(a, b):
+    res = 0
+    while b:
+        if b & 1:
+            res ^= a
+        b >>= 1
+        a <<= 1
+        if a >> 256:
+            a ^= P
+    return res
+
+
+poly = 2
+for _ in range(FIRST):
+    poly = mulmod(poly, poly)
+out = sys.stdout
+for _ in range(COUNT):
+    words = ", ".join(f"0x{(poly >> (64 * i)) & WORD:016x}ULL" for i in range(4))
+    out.write(f"    {{{words}}},\n")
+    poly = mulmod(poly, poly)
@@ -10,6 +10,9 @@ TARGET_PATH = sys.argv[2]
 reg_local = re.compile(R' *#include +".+"')
 reg_normal = re.compile(R' *#include +<.+>')
 
+# POSIX-only headers, not merged so that testgen.hpp builds everywhere; include them separately
+EXCLUDED = {"mapped.hpp"}
+
 filemap = dict()
 includes_set = set()
 
@@ -28,6 +31,8 @@ class File:
 
 for root, dirs, files in os.walk(SRC_PATH):
     for name in files:
+        if name in EXCLUDED:
+            continue
         path = os.path.join(root, name)
         filemap[name] = File(path, name)
 
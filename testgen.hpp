@@ -6,18 +6,60 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <functional>
 #include <initializer_list>
+#include <ios>
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <memory>
 #include <numeric>
+#include <optional>
 #include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace test {
+/* ==================== parallel.hpp ====================*/
+
+namespace detail {
+
+// calls fun(i) for every i in [0, count), indices are handed out to threads one by one
+template<typename Fun>
+void parallel_for(std::size_t count, unsigned threads, Fun && fun) {
+    auto const workers = static_cast<std::size_t>(std::max(1U, threads));
+    std::atomic<std::size_t> next{0};
+    auto const worker = [&] {
+        for(std::size_t i{}; (i = next++) < count;) {
+            fun(i);
+        }
+    };
+    std::vector<std::thread> pool;
+    for(std::size_t t = 1; t < std::min(workers, count); ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for(auto & thread : pool) {
+        thread.join();
+    }
+}
+
+} /* namespace detail */
+
 /* ==================== util.hpp ====================*/
 
 void assume(bool value) {
@@ -28,12 +70,208 @@ void assume(bool value) {
 
 constexpr uint64_t TESTGEN_SEED = 0;
 
+template<std::size_t Lanes>
+class Xoshiro256ppSimd;
+
+namespace detail {
+/* Polynomials over GF(2) of degree < 256, bit b of word w is coefficient of x^(64w + b).
+ * Advancing xoshiro256 by k steps is multiplication of its state by x^k mod P,
+ * where P is characteristic polynomial of its transition matrix. */
+using jump_poly_t = std::array<uint64_t, 4>;
+
+// lower 256 bits of P, coefficient of x^256 is 1
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+constexpr jump_poly_t CHARACTERISTIC_POLYNOMIAL = {0x9d116f2bb0f0f001ULL, 0x0280002bcefd1a5eULL, 0x04b4edcf26259f85ULL, 0x0003c03c3f3ecb19ULL};
+
+// x * a mod P
+constexpr jump_poly_t poly_mulx(jump_poly_t a) {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    auto const overflow = (a[3] >> 63U) != 0;
+    for(auto i = a.size() - 1; i > 0; --i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        a[i] = (a[i] << 1U) | (a[i - 1] >> 63U);
+    }
+    a[0] <<= 1U;
+    if(overflow) {
+        for(std::size_t i = 0; i < a.size(); ++i) {
+            a[i] ^= CHARACTERISTIC_POLYNOMIAL[i];
+        }
+    }
+    return a;
+}
+
+// a * b mod P
+constexpr jump_poly_t poly_mulmod(jump_poly_t const & a, jump_poly_t b) {
+    constexpr unsigned WORD_WIDTH = 64;
+    jump_poly_t res{};
+    for(auto word : a) {
+        for(unsigned bit = 0; bit < WORD_WIDTH; ++bit) {
+            if((word >> bit & 1U) != 0) {
+                for(std::size_t i = 0; i < res.size(); ++i) {
+                    res[i] ^= b[i];
+                }
+            }
+            b = poly_mulx(b);
+        }
+    }
+    return res;
+}
+
+// JUMP_POLYNOMIALS[k] = x^(2^(128 + k)) mod P, generated by scripts/jump_polynomials.py
+// k = 0 and k = 64 are reference JUMP and LONG_JUMP constants of xoshiro256++
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+inline constexpr std::array<jump_poly_t, 128> JUMP_POLYNOMIALS = {{
+    {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL},
+    {0x8cfe9bd9ab71d992ULL, 0xccfc8ca2814de79eULL, 0xa5a28cccb37dba5bULL, 0xa23e49ee6f1a7a8dULL},
+    {0x1b2a94a672a48c05ULL, 0x5e38f4fbb6fcda72ULL, 0xca8a45310219dc67ULL, 0xd4e9921bccb8090bULL},
+    {0xf30974a2b1dbbb71ULL, 0x34cd4cc8228d74acULL, 0xfa0587a90f717438ULL, 0xee658f69deb5df26ULL},
+    {0xb42bd4670583b289ULL, 0xd2c0d8e0c8a2fb9bULL, 0x2573e3218d8bb7daULL, 0xd7aaaf48aa459c58ULL},
+    {0xf6a5ab84efb67883ULL, 0xcc7efdcfed1ac303ULL, 0xd82be75b83dbc2d0ULL, 0x8fd437c01abeab24ULL},
+    {0xc85ee5171484f5a4ULL, 0xedc8b8d02a22310bULL, 0xb0b87a330b854c8aULL, 0x7d16742eceb4d5abULL},
+    {0x4298ba0e862a6007ULL, 0x4157dc48443e3565ULL, 0x13c97c0891cab48aULL, 0x6533981804b420eaULL},
+    {0xee5f5a6f02dfe47cULL, 0xedc28c89cb341660ULL, 0x613b2ed9f0acc107ULL, 0xa1ee335d14807ae0ULL},
+    {0x5ec3050c6b43565aULL, 0x4b26f71c1fb1b47bULL, 0x0531513e8e0ac706ULL, 0x799d469b2145a8a3ULL},
+    {0x34f0a6799020283eULL, 0x7123f2290a1f413bULL, 0xb6acd7be4906b73dULL, 0x6007bb31ec5a2964ULL},
+    {0xaa0711c54877febdULL, 0x54fe6df4cff0db73ULL, 0x7e42d6f544840499ULL, 0xec907801890a47abULL},
+    {0x03833e601d82a673ULL, 0x3ec263f5c999196eULL, 0xd8c4367e574ab160ULL, 0x964e9d188c16508eULL},
+    {0xd64f3f2aaf8f2171ULL, 0xf524fd4408357a5cULL, 0x15ac212f3b861b5aULL, 0x24d9ba21277dd8d8ULL},
+    {0xfe9b778d7d1ca2deULL, 0xbbe0e2c0c44b2e1cULL, 0x17a7af3e97d8c402ULL, 0xf89354cfe1e6b5fbULL},
+    {0x695cf225704e767dULL, 0xf4873d277cd1ab72ULL, 0xaad8c318bc459cceULL, 0xb89526857566cd94ULL},
+    {0x3dcd32f39276a95fULL, 0xc51212c8b1aa2787ULL, 0x962c90a866ea6719ULL, 0xb81875d0f4f6f253ULL},
+    {0xb43cf8e4eaf8e068ULL, 0x1c554e97b2277f47ULL, 0xa5a140826c351d07ULL, 0x11495a1b200d4eb8ULL},
+    {0x417b73b324735d32ULL, 0xff957b6f55288048ULL, 0x05af69bf1fb82891ULL, 0x3e53bfa0db28e110ULL},
+    {0xb6c7a6004612889cULL, 0xfdb3f4ea18f0a56bULL, 0xd3da65e82bdd39e2ULL, 0x48f6214560239b46ULL},
+    {0xf1267ba0ec3c645eULL, 0xd9dc0929a54fea75ULL, 0xec60b640d685171dULL, 0xde364ef64a484f59ULL},
+    {0x2761cbab38e0f580ULL, 0xd7f1c5ade3de404aULL, 0xcb6286958a9af01aULL, 0x2b29c7d3ef18d3b3ULL},
+    {0x5a5ce93f67a3cdd6ULL, 0x547db3576511edc2ULL, 0x99455c744595c01fULL, 0x6a3b6a431109e3d1ULL},
+    {0xafd80c1c832a739eULL, 0x0d9d73da9f40f374ULL, 0xed1d0a619aa60748ULL, 0x00d2333b0c03f620ULL},
+    {0x11428ceb13f2cc2cULL, 0xef46e42368baead3ULL, 0x2a47bd3fc39081daULL, 0x3f03458e0273439bULL},
+    {0x47558e815c898e8bULL, 0x9f8160e9d0124398ULL, 0x0fdcfd4ab0f5afeeULL, 0xade2626c292a2a9fULL},
+    {0xe848ff06d72a9252ULL, 0xf8be2d3d6ce206b0ULL, 0xd84fc5f798c1a55eULL, 0xc35abe5cebab1ba4ULL},
+    {0xb0dd0edb19af078cULL, 0xee1d857a675ca074ULL, 0x60ef7116e6f3c1e0ULL, 0x7c25b2c3282fb730ULL},
+    {0xb51a19064886308aULL, 0x6b590805d407e77eULL, 0x57059d3707ee283aULL, 0x6298f48fa13cc12fULL},
+    {0x4f1102acb29c3230ULL, 0xcf69cee6182fa164ULL, 0x1780be415c86b5d5ULL, 0xab5d0760d1fe77dcULL},
+    {0xc639b7c24b26ef11ULL, 0xa57d650a8007d505ULL, 0xd81275131f4f91f8ULL, 0x10000e5f7bf7a58bULL},
+    {0x295b23eaa04478edULL, 0xf1d3279f36823213ULL, 0x743eedc2ede6d478ULL, 0x09d89163f581d1e0ULL},
+    {0xc04b4f9c5d26c200ULL, 0x69e6e6e431a2d40bULL, 0x4823b45b89dc689cULL, 0xf567382197055bf0ULL},
+    {0x09f16c9da06c8a66ULL, 0xf32c270b20ce5f38ULL, 0xbe61763d20685d37ULL, 0xda01b157a2b021e9ULL},
+    {0xc6d70a8c6aec7778ULL, 0xaccd356978aafc8eULL, 0xa1fbf40a9936c15dULL, 0x9d7c0c2cf565896cULL},
+    {0x90c526d9d0b6773fULL, 0x327a229ce1248578ULL, 0xfbdcc8828b2c1889ULL, 0x592056e6bbf026f6ULL},
+    {0xa14aaaccc2890705ULL, 0xe63e390ab5f8a1a5ULL, 0x0fbd392d992b9686ULL, 0x746ea463d01f96a4ULL},
+    {0xd8cd74de1850f135ULL, 0x441424d88baa1859ULL, 0xb4bb676b08602d23ULL, 0x4d1dc582c66946beULL},
+    {0x2adbc6211da0644cULL, 0x994b90f8d7149b3dULL, 0x4b145a211d1fdfdfULL, 0x621c1b93e8fa1183ULL},
+    {0x2fd0c3d604d53cdfULL, 0x340889c14a3c5736ULL, 0x7bd5128045929790ULL, 0xfaf3fe8684e4e611ULL},
+    {0x01e53e1bc659d517ULL, 0x5f15699d4848bfccULL, 0x6d8bf975dcc01074ULL, 0x4a55ccb047f7ed1fULL},
+    {0x71ce8d56b9692c38ULL, 0x629372507db35e61ULL, 0xefcb70ac050d5190ULL, 0x929a14fdb0efb0b5ULL},
+    {0x27d627035f8c74a5ULL, 0xe890fcbab799d186ULL, 0xde5841dcae8e37bbULL, 0xcf9e9a1026630265ULL},
+    {0xb405010a26f11c18ULL, 0xfd3a5a8b24565256ULL, 0x9d53ec478a607c58ULL, 0xbfbcf2e3dee7abfaULL},
+    {0xb072a316838de4eeULL, 0x8f148500f69fe8f8ULL, 0xbc2ad4d4d5a4ecb8ULL, 0x20d9430de74248c9ULL},
+    {0x732bd9e5c94b916aULL, 0xa0851e63a9ec247cULL, 0x63eb42892a0f4361ULL, 0x6db40995b68e4c68ULL},
+    {0xe87d88258b7992ceULL, 0xb38ada6d1a5427baULL, 0x29f4387fbb3eebe2ULL, 0x08543e7ab4077f43ULL},
+    {0x6735bb34738c34f7ULL, 0x0a1db90231a55a32ULL, 0x7f05b87543072eb8ULL, 0x2281c456455c4a6dULL},
+    {0x053ff7e4e8581163ULL, 0x0b4df9e68366344aULL, 0x259022fe05f4023eULL, 0x2432aaa71d816e63ULL},
+    {0xfc89e47923390d01ULL, 0x81690de70406c5b2ULL, 0xdcdf361320fa2c0bULL, 0x065e8192b0d9e2abULL},
+    {0x54ae81c77079738dULL, 0xe3da1faabf2f681dULL, 0xfac68c11fe1e596cULL, 0x6f46880c9915650eULL},
+    {0x9350f3f8897dc5ccULL, 0x3ac1fea4d54d0710ULL, 0x70f4ef60d5dd3890ULL, 0x8de6f3aa90cec548ULL},
+    {0xe7b23f10622b3386ULL, 0xc22f28a3d0afc80bULL, 0xcb5512bde4e7bf59ULL, 0xf930e902851defa3ULL},
+    {0xcaefa30f55ce5c0fULL, 0x7bf0fe15bdc9337fULL, 0x7a55e55bbd72fb81ULL, 0xb05640b794289f31ULL},
+    {0x30121e7a60194d6aULL, 0xb8b27bb7572d2871ULL, 0x61d6cf653e616a08ULL, 0x0fa65f166fbb0db4ULL},
+    {0x646fe4bfa600d564ULL, 0x3444a78d93dffc9aULL, 0x1c46fb7ea0484857ULL, 0x7a974830be953c4aULL},
+    {0x0ffabb6c5ce8d644ULL, 0xbe489e3f8ac41534ULL, 0xb8f35b514eb14767ULL, 0x7691957a691df817ULL},
+    {0x5b16024d0563a65aULL, 0x83f997e75e88067fULL, 0xa9c11c5aaf2cab97ULL, 0x57f44892a2ad86eaULL},
+    {0xa6c7eee290c62375ULL, 0x7fe5c232f064f464ULL, 0x947c9b3af027e791ULL, 0x6062e8c7dc309cb2ULL},
+    {0x038e07e40a2812e1ULL, 0x52a29a371c84710fULL, 0x4c5bac1c57856ed7ULL, 0x2629bab11c98b6aeULL},
+    {0x637242c48b99b633ULL, 0x3e3494a05f161ecdULL, 0xc3f6fbf07e464327ULL, 0xaaa38210dde97c64ULL},
+    {0xc4d01c7eb078fd29ULL, 0xc188ca2c76798705ULL, 0x81d165297d239d2aULL, 0xd6e3b368fb2a3110ULL},
+    {0x7f90ffb775c02726ULL, 0xacfe2b03b09803d0ULL, 0x5a70368075759194ULL, 0x6309de7dbb3bf59dULL},
+    {0xf0f03027dfdc22d5ULL, 0x902b0ee66222acc7ULL, 0x78a3e873f00291edULL, 0xdb9d6b2d354321b4ULL},
+    {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL},
+    {0x85d1837e6f0cd3feULL, 0xa4b0488571edcb9dULL, 0xe9edb73cb3e9fb7cULL, 0xba70f1bd97fc40b0ULL},
+    {0xac54fa504c60e306ULL, 0x0b893c16e4a7f3b3ULL, 0xaff90eda09ea8b4cULL, 0x3727c275522644a7ULL},
+    {0x302eda308643ab47ULL, 0xc9a202b2322bb7f6ULL, 0xd4483ff9a9ac5a23ULL, 0x574e4d0093e3a2e4ULL},
+    {0x261882d92ec8429fULL, 0xabfffe7ac9ea1612ULL, 0x236417db3b031424ULL, 0xec6aa16a8ffc76faULL},
+    {0x52f6a62700009087ULL, 0xf7c39d8fc76906a3ULL, 0x285943d7fb75d765ULL, 0x88e5349d50f3ddefULL},
+    {0x3facc68ed0053ac4ULL, 0xfc0c646fb82afcebULL, 0xf055378c576c5c9aULL, 0x21588c86cc534c29ULL},
+    {0xfe596054913ed407ULL, 0x3d38ff4fc965c1faULL, 0x776751b126655d13ULL, 0x443c1363fd5c7d43ULL},
+    {0x1a672a03c71adc2eULL, 0x6217b3306e3e9557ULL, 0x163160efcad9c046ULL, 0x5243e79672334390ULL},
+    {0x58ce1e7d6ea9281fULL, 0x5348b64c107873b6ULL, 0xdabe97e1dd9a59c1ULL, 0x2dcec71c419baa62ULL},
+    {0x955659c7b8793ecfULL, 0x37fae57370f8bc19ULL, 0xfba1683b54b1e0f6ULL, 0xe91553475948d23eULL},
+    {0xbb5b5c8aa1ad89e1ULL, 0x9d7c00c8471ddc07ULL, 0xa910bdeff21ce218ULL, 0x540fca0570720eb7ULL},
+    {0x0612914f1b46c912ULL, 0x6d8abce0cf641cfcULL, 0x32f22fb19ac4550bULL, 0xc4b65c3551c83c69ULL},
+    {0x536e6114e4189cfcULL, 0xbe100596c8da9541ULL, 0xee7eb44f2fdbd1b8ULL, 0xb1170d0754beeaa4ULL},
+    {0xbeb789dbbc4ea209ULL, 0x267d7103ef9f83a3ULL, 0x93f548c2cab0a32cULL, 0x45cac579389af5caULL},
+    {0x65ceb6cde220e757ULL, 0xd6f9074a4c2732f7ULL, 0xa8e0425b0d01cd1eULL, 0x2b75c5d185461341ULL},
+    {0xafbacb099d1967bdULL, 0x1af87374102c1031ULL, 0x470868184fcc3f5fULL, 0x114dcbb43b155057ULL},
+    {0x5f98e9b5ad62427dULL, 0xf27e722d27743cd9ULL, 0x7ebe95d47cd1daf2ULL, 0x1b98494373c20b8aULL},
+    {0x8f1d0f5ec26521a6ULL, 0x036e9886f63c9933ULL, 0x4ac6fab0688e4ccdULL, 0x93d03eea25d1d816ULL},
+    {0xdd4e745e4412a26aULL, 0xbb62b24404a1be96ULL, 0x9c227b5ba376faeeULL, 0x08615908bcc4c8f2ULL},
+    {0xebe0d315a9cb279bULL, 0xc7a967d45d82bbcaULL, 0x64d85cc844957794ULL, 0xf6a1ef6a7d3b2545ULL},
+    {0x29bfb1bdc678fcbeULL, 0x611e5aedd44a4fd4ULL, 0xd188547deb3f0136ULL, 0x2b8dd348e0f767aeULL},
+    {0xfad25fa87d091580ULL, 0x5154a018eba8e309ULL, 0xbd9b522fb9f15d0bULL, 0xfcd653bc999d276bULL},
+    {0x29c79a4cedb3baf2ULL, 0x946592914b67e34fULL, 0x04921932aaf82150ULL, 0xb36394657868f06eULL},
+    {0x6cbfcd64bf69402cULL, 0xca9a2b49a6e6b16dULL, 0xba835279ffb6a358ULL, 0xfbdf21da0bb9add0ULL},
+    {0x23436782d086ca23ULL, 0x0cf66f05d413a46dULL, 0xbb90914a9c9871a3ULL, 0xedcce16aeb59e5adULL},
+    {0x130e23fa572004a9ULL, 0xf9ce20dec18c4b44ULL, 0x5cea7b8a1ac11de9ULL, 0x6608d757c7d36be3ULL},
+    {0x70c7a48f09b95bb9ULL, 0xd03a1ed309668f2fULL, 0xa955e448a10873d4ULL, 0xd5d4c6699513858fULL},
+    {0x72015cf80ce336f4ULL, 0x619c9d98f6f33bcbULL, 0x59f1b7e5d5fbfdc3ULL, 0x16cac53fc2905146ULL},
+    {0x5f340fcb5be19401ULL, 0xce2129cd34ae493aULL, 0x14690cfa36c329edULL, 0xc6e96787aedc5c40ULL},
+    {0x7ad9f632881e960fULL, 0xb8052dcca0e13395ULL, 0xd457241f6a9863acULL, 0xf8d2e75e66d53d83ULL},
+    {0x23336699f63c8e45ULL, 0x33b2e33e1d4e5bdbULL, 0x37fdeee585fdcd8eULL, 0x9a5144da7f765fd8ULL},
+    {0x0c7840cbc3b121adULL, 0xd317530723ab526aULL, 0xf31d2e03157bc387ULL, 0xa2b5d83a373c7ac2ULL},
+    {0x47b3063d7d254e4cULL, 0xea7c37e6ee511ddfULL, 0x0b50e1ab78926eefULL, 0x3ff3ff3e9168fd71ULL},
+    {0x2c56cd0f48e4587dULL, 0x4c77464d80c69c23ULL, 0xcbbf60dca92d32deULL, 0x6021ef776e85bae8ULL},
+    {0xe3521a7cbf37c2a1ULL, 0xa5130e508b35bcf2ULL, 0xf308dc3d84a999f1ULL, 0x601a299a0bbe06e1ULL},
+    {0xde3439ebd3e4fcefULL, 0x5b1dcb68d8e77159ULL, 0xb00b42e8b528bff6ULL, 0x9b121812c345eb87ULL},
+    {0x07eb2f053805555cULL, 0xa7f205f341a367e5ULL, 0x5d5d85d95fc59359ULL, 0x057f094f242a8701ULL},
+    {0x2e990fa0b86f494dULL, 0x5d3d62bea3d0c982ULL, 0x2be3af695f4ca02dULL, 0xcc92a4a3521dba28ULL},
+    {0xdd8082fb069d5ee7ULL, 0x7dc029224f1676fbULL, 0x65e7ab91abe659d0ULL, 0x04fb453c7ad02c02ULL},
+    {0x90b632d403b4513cULL, 0x0f186a740aaa16b5ULL, 0xb93a0637f3af87f7ULL, 0x3910377fe08e48a3ULL},
+    {0xcafe235cd7fe7ef0ULL, 0x5f1e003e1d3a7dafULL, 0x7f5505759890b722ULL, 0xf2f7c89f1379cf05ULL},
+    {0x5a252ed34d09cd4fULL, 0xe8f150b98011d5feULL, 0x131bf6c475e29db1ULL, 0x07818fb0f5b0ff11ULL},
+    {0x0441124ba35b2f58ULL, 0x9d4b489eae71f97dULL, 0x50fa45528d32be3aULL, 0xce8349b10acdabcaULL},
+    {0xade4816bccf327acULL, 0xc14a5bff8ad78a52ULL, 0x4cc84cfe14a77c57ULL, 0x183c124cf3d64e0bULL},
+    {0x4dbeffc02ebf0904ULL, 0xc3b545955dbab803ULL, 0xb7fa51c1fe79c53bULL, 0x688b6947de87d7e9ULL},
+    {0x2f5b386d0a416de5ULL, 0xdd87232f5cca256aULL, 0x7ba82a958b9e6a9aULL, 0x2c55c09810b2f548ULL},
+    {0xf75f6b5cec404580ULL, 0x8f0aa8baea9011fdULL, 0x1221c7c14b1db112ULL, 0x1d8ee30bc2f88017ULL},
+    {0xd18562b8cfa0694fULL, 0xba5487bfcecce199ULL, 0xde5eb81978735ad0ULL, 0x33a1c005e4ccc286ULL},
+    {0xdca75eca4474cbe5ULL, 0x0388cd9f71f314e3ULL, 0xd4699ceb082644c3ULL, 0x1271254993f074aaULL},
+    {0x1c493fa07fa74dcdULL, 0xb59cd5fcb429c2a9ULL, 0x3e550b09e8493d84ULL, 0x516fabbf03d78293ULL},
+    {0xe6d4233d77a1930dULL, 0x00424fa384fbe6eeULL, 0x4c636e19b68da5afULL, 0x140c9813f8542a71ULL},
+    {0xbea7da1e4eabfb2cULL, 0x271441e275aceb6bULL, 0x00ef11ecb78fd7ddULL, 0x3564fd80ea4578c1ULL},
+    {0xaf64e36a267033fdULL, 0xb86eb7a249850b0fULL, 0x9a888e9f318a8efeULL, 0x734c58deea6bd24bULL},
+    {0x30765a1ca7975996ULL, 0xeb222e5b91776decULL, 0x27e74ceb6b5c8a44ULL, 0xaea3b00f90869cf7ULL},
+    {0xc41171736f6127bdULL, 0xbbe041e1a6089bafULL, 0x623b0619adb26e6bULL, 0xc119ec86604ac1deULL},
+    {0xcc48029f3903aa23ULL, 0xddf1854fc56579d8ULL, 0xaa69f6bbf9bfebccULL, 0xfc1385169b03eb72ULL},
+    {0x409b2e169eb1bbfaULL, 0x771b06055d169793ULL, 0x47bf1babcb2b82f5ULL, 0xace055588e22fd26ULL},
+    {0x01731918ee54abd6ULL, 0x759a7ec7f27f3792ULL, 0xb4d6164f3e9d573eULL, 0xb604b97729a3c214ULL},
+    {0x1a22142b7cc54bcfULL, 0x43461d4569c23fa4ULL, 0x8d7ff0d4f4fb9470ULL, 0x1a825a9fac612b54ULL},
+    {0x39da610606e0e771ULL, 0x4566a69758dd856dULL, 0x1c60396a2c51aa0bULL, 0xf418b6ce5a857da3ULL},
+    {0xdfca68648b28c5afULL, 0xb56437fb2b753802ULL, 0xebb82aacdf6ca80dULL, 0xa170e108788db093ULL},
+    {0xde5b821c4a3d86e8ULL, 0x861fffe004c85acaULL, 0x3413838181a6096fULL, 0x460de3bdbe1cb3acULL},
+    {0x5b7b491f49ccffccULL, 0xae7f8689b0bbd6a0ULL, 0x13865b737d9739bcULL, 0x6c132e0c5374c916ULL},
+}};
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+constexpr bool check_jump_polynomials(std::size_t k) {
+    auto const square = poly_mulmod(JUMP_POLYNOMIALS[k], JUMP_POLYNOMIALS[k]);
+    for(std::size_t i = 0; i < square.size(); ++i) {
+        if(square[i] != JUMP_POLYNOMIALS[k + 1][i]) { return false; }
+    }
+    return true;
+}
+
+static_assert(check_jump_polynomials(0));
+} /* namespace detail */
+
 class Xoshiro256pp {
     // Suppress magic number linter errors (a lot of that in here and that is normal for a RNG)
 public:
     using result_type = uint64_t;
 
 private:
+    template<std::size_t Lanes>
+    friend class Xoshiro256ppSimd;
+
     std::array<result_type, 4> s{};
 
     static inline result_type rotl(result_type x, unsigned k) {
@@ -53,13 +291,13 @@ private:
         s[3] = rotl(s[3], 45U);
     }
 
-    void jump() {
-        static constexpr std::array JUMP = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    // t = poly(A) * s, where A is the transition matrix of advance()
+    void applyPolynomial(detail::jump_poly_t const & poly) {
         static constexpr unsigned RESULT_TYPE_WIDTH = 64;
         std::array<result_type, 4> t{};
-        for(auto jump : JUMP) {
+        for(auto word : poly) {
             for(unsigned b = 0; b < RESULT_TYPE_WIDTH; b++) {
-                if((jump & UINT64_C(1) << b) != 0) {
+                if((word & UINT64_C(1) << b) != 0) {
                     t[0] ^= s[0];
                     t[1] ^= s[1];
                     t[2] ^= s[2];
@@ -71,6 +309,21 @@ private:
         std::copy(t.begin(), t.end(), s.begin());
     }
 
+    // advance by n * 2^(128 + first) steps
+    void jumpPower(uint64_t n, unsigned first) {
+        static constexpr unsigned RESULT_TYPE_WIDTH = 64;
+        if(n == 0) { return; }
+        unsigned b = 0;
+        while((n >> b & 1U) == 0) { ++b; }
+        auto poly = detail::JUMP_POLYNOMIALS[first + b];
+        while(++b < RESULT_TYPE_WIDTH) {
+            if((n & UINT64_C(1) << b) != 0) {
+                poly = detail::poly_mulmod(poly, detail::JUMP_POLYNOMIALS[first + b]);
+            }
+        }
+        applyPolynomial(poly);
+    }
+
 public:
     explicit Xoshiro256pp(result_type seed) noexcept {
         auto next_seed = [x = seed]() mutable {
@@ -94,6 +347,44 @@ public:
         return result;
     }
 
+    // same values as n consecutive calls to operator(), but state is kept in registers
+    void fill(result_type * out, std::size_t n) noexcept {
+        auto s0 = s[0];
+        auto s1 = s[1];
+        auto s2 = s[2];
+        auto s3 = s[3];
+        for(std::size_t i = 0; i < n; ++i) {
+            out[i] = rotl(s0 + s3, 23) + s0;
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            auto const t = s1 << 17U;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            s3 = rotl(s3, 45U);
+        }
+        s = {s0, s1, s2, s3};
+    }
+
+    template<typename Container>
+    void fill(Container & cont) noexcept {
+        static_assert(std::is_same_v<std::remove_reference_t<decltype(*std::data(cont))>, result_type>);
+        fill(std::data(cont), std::size(cont));
+    }
+
+    // same as n calls to jump(), i.e. advances by n * 2^128 steps, in O(log n) polynomial multiplications
+    void jump(uint64_t n = 1) noexcept {
+        jumpPower(n, 0);
+    }
+
+    // advances by n * 2^192 steps, one long jump is 2^64 jumps
+    void longJump(uint64_t n = 1) noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        jumpPower(n, 64);
+    }
+
     [[nodiscard]] Xoshiro256pp fork() noexcept {
         auto const result = *this;
         jump();
@@ -109,6 +400,115 @@ public:
     }
 };
 
+/* Lanes independent xoshiro256++ streams advanced together. State is kept as struct-of-arrays
+ * so every step is a sequence of lane-wise loops which compiler turns into vector instructions.
+ * Lane i starts where i-th fork() of Xoshiro256pp{seed} would, so lanes never overlap.
+ * Output is lane-interleaved: k-th word of every lane, then (k+1)-th and so on.
+ * Values depend only on seed and Lanes. */
+template<std::size_t Lanes = 4>
+class Xoshiro256ppSimd {
+    static_assert(Lanes > 0 && (Lanes & (Lanes - 1)) == 0, "number of lanes should be power of two");
+
+public:
+    using result_type = uint64_t;
+
+private:
+    using lanes_t = std::array<result_type, Lanes>;
+    using state_t = std::array<lanes_t, 4>;
+    state_t s{};
+    lanes_t buffer{};
+    std::size_t buffered{0};
+
+    static void step(state_t & state, result_type * out) noexcept {
+        auto & [s0, s1, s2, s3] = state;
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            out[l] = Xoshiro256pp::rotl(s0[l] + s3[l], 23) + s0[l];
+        }
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            auto const t = s1[l] << 17U;
+            s2[l] ^= s0[l];
+            s3[l] ^= s1[l];
+            s1[l] ^= s2[l];
+            s0[l] ^= s3[l];
+            s2[l] ^= t;
+            // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            s3[l] = Xoshiro256pp::rotl(s3[l], 45U);
+        }
+    }
+
+    void setLane(std::size_t l, Xoshiro256pp const & gen) noexcept {
+        for(std::size_t k = 0; k < s.size(); ++k) {
+            s[k][l] = gen.s[k];
+        }
+    }
+
+    [[nodiscard]] Xoshiro256pp getLane(std::size_t l) const noexcept {
+        Xoshiro256pp gen{0};
+        for(std::size_t k = 0; k < s.size(); ++k) {
+            gen.s[k] = s[k][l];
+        }
+        return gen;
+    }
+
+public:
+    explicit Xoshiro256ppSimd(result_type seed) noexcept {
+        Xoshiro256pp gen{seed};
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            setLane(l, gen.fork());
+        }
+    }
+
+    [[nodiscard]] result_type operator()() noexcept {
+        if(buffered == 0) {
+            step(s, buffer.data());
+            buffered = Lanes;
+        }
+        return buffer[Lanes - buffered--];
+    }
+
+    // same values as n consecutive calls to operator()
+    void fill(result_type * out, std::size_t n) noexcept {
+        for(; buffered > 0 && n > 0; --n) {
+            *out++ = buffer[Lanes - buffered--];
+        }
+        auto state = s; // local copy can not alias with out
+        for(; n >= Lanes; n -= Lanes, out += Lanes) {
+            step(state, out);
+        }
+        s = state;
+        for(; n > 0; --n) {
+            *out++ = (*this)();
+        }
+    }
+
+    template<typename Container>
+    void fill(Container & cont) noexcept {
+        static_assert(std::is_same_v<std::remove_reference_t<decltype(*std::data(cont))>, result_type>);
+        fill(std::data(cont), std::size(cont));
+    }
+
+    // every lane jumps over the streams of all lanes, so forked generator does not overlap with this one
+    [[nodiscard]] Xoshiro256ppSimd fork() noexcept {
+        auto const result = *this;
+        for(std::size_t l = 0; l < Lanes; ++l) {
+            auto gen = getLane(l);
+            gen.jump(Lanes);
+            setLane(l, gen);
+        }
+        buffered = 0;
+        return result;
+    }
+
+    static constexpr result_type max() {
+        return UINT64_MAX;
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+};
+
 using gen_type = Xoshiro256pp;
 
 template<typename T>
@@ -144,6 +544,11 @@ public:
         return (*gen)();
     }
 
+    template<typename U = T>
+    auto fill(typename U::result_type * out, std::size_t n) noexcept -> decltype(std::declval<U &>().fill(out, n)) {
+        return gen->fill(out, n);
+    }
+
     T & generator() {
         return *gen;
     }
@@ -171,12 +576,96 @@ public:
 template<typename T>
 inline constexpr bool is_generating_v = is_generating<T>::value; //NOLINT(readability-identifier-naming)
 
+enum class Sampling {
+    LEMIRE,       // unbiased multiply-shift with rejection, default
+    LEGACY_MODULO // gen() % range, use it to reproduce tests generated with older versions
+};
+
+namespace detail {
+// atomic, because it is read by tests generated in parallel; relaxed, as it only has to be set before they start
+inline std::atomic<Sampling> sampling{Sampling::LEMIRE}; //NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename Gen, typename = void>
+struct has_fill : std::false_type {}; //NOLINT(readability-identifier-naming)
+
+template<typename Gen>
+struct has_fill<Gen, std::void_t<decltype(std::declval<Gen &>().fill(std::declval<uint64_t *>(), std::size_t{}))>> : std::true_type {};
+
+template<typename Gen>
+inline constexpr bool has_fill_v = has_fill<std::remove_reference_t<Gen>>::value; //NOLINT(readability-identifier-naming)
+
+// words are drawn in blocks of this size when generator supports bulk generation
+constexpr std::size_t FILL_BLOCK = 256;
+
+/* Calls fun(word) on consecutive words of gen until it accepted (returned true) n of them.
+ * Never draws more words than were consumed, so gen ends in the same state as if words were drawn one by one. */
+template<typename Gen, typename Fun>
+void consume_words(Gen && gen, std::size_t n, Fun && fun) {
+    std::array<uint64_t, FILL_BLOCK> words; //NOLINT(cppcoreguidelines-pro-type-member-init, hicpp-member-init)
+    while(n > 0) {
+        auto const cnt = std::min(n, words.size());
+        gen.fill(words.data(), cnt);
+        for(std::size_t i = 0; i < cnt; ++i) {
+            if(fun(words[i])) { --n; }
+        }
+    }
+}
+
+__extension__ using uint128_t = unsigned __int128;
+
+/* Lemire's multiply-shift: res = word * range / 2^w, where w = 32 (high half of word) for small ranges and 64 otherwise.
+ * Unbiased as long as accepted low parts form a window of length 2^w - (2^w mod range). Window is
+ * [0, 2^w - t) instead of [t, 2^w) as in the paper, so word 0 is never rejected. Division is needed only
+ * when low part lands in the last 'range' values, i.e. almost never. Range 0 means 2^64. */
+inline bool lemire_map(uint64_t word, uint64_t range, uint64_t & res) noexcept {
+    constexpr uint64_t HALF = UINT64_C(1) << 32U;
+    if(range == 0) {
+        res = word;
+        return true;
+    }
+    if(range <= HALF) {
+        auto const m = (word >> 32U) * range;
+        auto const low = m & (HALF - 1);
+        res = m >> 32U;
+        auto const limit = HALF - range;
+        return low < limit || low < HALF - (limit % range);
+    }
+    auto const m = static_cast<uint128_t>(word) * range;
+    auto const low = static_cast<uint64_t>(m);
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    res = static_cast<uint64_t>(m >> 64U);
+    auto const limit = -range; // 2^64 - range
+    return low < limit || low <= ~(limit % range);
+}
+} /* namespace detail */
+
+inline void setSampling(Sampling sampling) noexcept {
+    detail::sampling.store(sampling, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline Sampling getSampling() noexcept {
+    return detail::sampling.load(std::memory_order_relaxed);
+}
+
 template<typename T>
 struct uni_dist {
 private:
     static_assert(std::is_integral_v<T>);
+    using unsigned_t = std::make_unsigned_t<T>;
     T begin, end;
 
+    // number of values in [begin:end], 0 means 2^64
+    static uint64_t width(T begin, T end) {
+        return static_cast<uint64_t>(static_cast<unsigned_t>(static_cast<unsigned_t>(end) - static_cast<unsigned_t>(begin))) + 1;
+    }
+
+    static bool sample(uint64_t word, T begin, uint64_t range, T & res) {
+        uint64_t offset{};
+        auto const accepted = detail::lemire_map(word, range, offset);
+        res = static_cast<T>(static_cast<unsigned_t>(static_cast<unsigned_t>(begin) + static_cast<unsigned_t>(offset)));
+        return accepted;
+    }
+
 public:
     uni_dist(T begin, T end) :
       begin(begin), end(end) {
@@ -190,8 +679,112 @@ public:
 
     template<typename Gen>
     static T gen(T begin, T end, Gen && gen) {
-        auto const range = end - begin + 1;
-        return (gen() % range) + begin; // not really uniform, but close enough
+        if(getSampling() == Sampling::LEGACY_MODULO) {
+            auto const range = end - begin + 1;
+            return (gen() % range) + begin; // not really uniform, but close enough
+        }
+        auto const range = width(begin, end);
+        T res{};
+        while(!sample(static_cast<uint64_t>(gen()), begin, range, res)) {}
+        return res;
+    }
+
+    template<typename Gen>
+    void fill(T * out, std::size_t n, Gen && gen) const {
+        uni_dist::fill(begin, end, out, n, std::forward<Gen>(gen));
+    }
+
+    // same values as n consecutive calls to gen(begin, end, gen)
+    template<typename Gen>
+    static void fill(T begin, T end, T * out, std::size_t n, Gen && gen) {
+        if constexpr(detail::has_fill_v<Gen>) {
+            if(getSampling() == Sampling::LEGACY_MODULO) {
+                auto const range = end - begin + 1;
+                detail::consume_words(gen, n, [&](uint64_t word) {
+                    *out++ = (word % range) + begin;
+                    return true;
+                });
+            } else {
+                auto const range = width(begin, end);
+                detail::consume_words(gen, n, [&](uint64_t word) {
+                    if(!sample(word, begin, range, *out)) { return false; }
+                    ++out;
+                    return true;
+                });
+            }
+        } else {
+            std::generate_n(out, n, [&] { return uni_dist::gen(begin, end, gen); });
+        }
+    }
+};
+
+/* Index i from [0, n) drawn with probability weights[i] / (sum of weights), exactly.
+ * Integer alias table (Walker, Vose): O(n) construction, then one uniform word per sample,
+ * which picks both the column and the threshold. Requires n * (sum of weights) < 2^64. */
+class discrete_dist { //NOLINT(readability-identifier-naming)
+    std::vector<uint64_t> threshold;
+    std::vector<uint> alias;
+    uint64_t total{0};
+
+    [[nodiscard]] uint column(uint64_t k) const noexcept {
+        auto const i = static_cast<uint>(k / total);
+        return k % total < threshold[i] ? i : alias[i];
+    }
+
+public:
+    explicit discrete_dist(std::vector<uint64_t> const & weights) :
+      threshold(weights.size()), alias(weights.size()) {
+        auto const n = weights.size();
+        assume(n >= 1);
+        for(auto w : weights) {
+            total += w;
+        }
+        assume(total >= 1 && total <= UINT64_MAX / n);
+        // column i holds total units, weight w is scaled to w * n units
+        std::vector<uint> small;
+        std::vector<uint> large;
+        for(uint i = 0; i < n; ++i) {
+            threshold[i] = weights[i] * n;
+            alias[i] = i;
+            (threshold[i] < total ? small : large).push_back(i);
+        }
+        while(!small.empty() && !large.empty()) {
+            auto const s = small.back();
+            small.pop_back();
+            auto const l = large.back();
+            alias[s] = l;
+            threshold[l] -= total - threshold[s];
+            if(threshold[l] < total) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        for(auto i : large) {
+            threshold[i] = total;
+        }
+    }
+
+    template<typename Gen>
+    uint operator()(Gen && gen) const {
+        return column(uni_dist<uint64_t>::gen(0, threshold.size() * total - 1, std::forward<Gen>(gen)));
+    }
+
+    // same values as n consecutive calls to operator()
+    template<typename Gen>
+    void fill(uint * out, std::size_t n, Gen && gen) const {
+        constexpr std::size_t BLOCK = 256;
+        std::array<uint64_t, BLOCK> words{};
+        for(std::size_t done = 0; done < n; done += BLOCK) {
+            auto const count = std::min(BLOCK, n - done);
+            uni_dist<uint64_t>::fill(0, threshold.size() * total - 1, words.data(), count, gen);
+            for(std::size_t i = 0; i < count; ++i) {
+                out[done + i] = column(words[i]);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return threshold.size();
     }
 };
 
@@ -208,8 +801,25 @@ void shuffle_sequence(Iter begin, Iter end, Gen && gen) {
     if(begin == end) {
         return;
     }
-    for(auto it = begin; ++it != end;) {
-        detail::iter_swap(it, begin + uni_dist<size_t>(0, std::distance(begin, it))(gen));
+    if constexpr(detail::has_fill_v<Gen>) {
+        // same swaps as below, but words are drawn in blocks
+        std::size_t i = 1;
+        auto const n = static_cast<std::size_t>(std::distance(begin, end));
+        detail::consume_words(gen, n - 1, [&](uint64_t word) {
+            uint64_t j{};
+            if(getSampling() == Sampling::LEGACY_MODULO) {
+                j = word % (i + 1);
+            } else if(!detail::lemire_map(word, i + 1, j)) {
+                return false;
+            }
+            detail::iter_swap(begin + i, begin + j);
+            ++i;
+            return true;
+        });
+    } else {
+        for(auto it = begin; ++it != end;) {
+            detail::iter_swap(it, begin + uni_dist<size_t>(0, std::distance(begin, it))(gen));
+        }
     }
 }
 
@@ -220,6 +830,153 @@ std::vector<uint> get_permutation(int n, gen_type & gen) {
     return V;
 }
 
+namespace detail {
+
+// uniform double in [0, 1) from 53 high bits of word
+inline double to_unit_interval(uint64_t word) {
+    constexpr auto MANTISSA = 53U;
+    return static_cast<double>(word >> (64U - MANTISSA)) * 0x1p-53; // NOLINT(*-magic-numbers)
+}
+
+/* Set of 64-bit indices with open addressing and linear probing in one preallocated array,
+ * for sampling without replacement; capacity is fixed at construction. */
+class IndexSet {
+    static constexpr uint64_t EMPTY = ~uint64_t{0};
+    static constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15; // NOLINT(*-magic-numbers)
+
+    std::vector<uint64_t> slots;
+    uint64_t mask;
+    unsigned shift;
+
+    [[nodiscard]] std::size_t slot(uint64_t key) const noexcept {
+        return static_cast<std::size_t>((key * MULTIPLIER) >> shift);
+    }
+
+public:
+    // at least twice as many slots as elements
+    explicit IndexSet(std::size_t max_size) {
+        unsigned bits = 1;
+        while((std::size_t{1} << bits) < 2 * max_size) {
+            ++bits;
+        }
+        slots.assign(std::size_t{1} << bits, EMPTY);
+        mask = slots.size() - 1;
+        shift = 64U - bits;
+    }
+
+    // returns false if key was already present
+    bool insert(uint64_t key) {
+        for(auto i = slot(key);; i = (i + 1) & mask) {
+            if(slots[i] == key) { return false; }
+            if(slots[i] == EMPTY) {
+                slots[i] = key;
+                return true;
+            }
+        }
+    }
+
+    [[nodiscard]] bool contains(uint64_t key) const {
+        for(auto i = slot(key);; i = (i + 1) & mask) {
+            if(slots[i] == key) { return true; }
+            if(slots[i] == EMPTY) { return false; }
+        }
+    }
+
+    // returns false if key was not present; backward shift deletion, so no tombstones are left
+    bool erase(uint64_t key) {
+        auto i = slot(key);
+        for(; slots[i] != key; i = (i + 1) & mask) {
+            if(slots[i] == EMPTY) { return false; }
+        }
+        // entry at j may fill hole at i if its home slot is not in (i, j]
+        for(auto j = (i + 1) & mask; slots[j] != EMPTY; j = (j + 1) & mask) {
+            if(((j - slot(slots[j])) & mask) >= ((j - i) & mask)) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i] = EMPTY;
+        return true;
+    }
+};
+
+// calls fun(k) for every k from [0, N) independently with probability p, in increasing order
+// geometric skipping (Batagelj, Brandes 2005), expected O(pN + 1) time
+template<typename Fun>
+void bernoulli_indices(uint64_t N, double p, gen_type & gen, Fun && fun) {
+    if(p <= 0) { return; }
+    if(p >= 1) {
+        for(uint64_t k = 0; k < N; ++k) {
+            fun(k);
+        }
+        return;
+    }
+    auto const log_q = std::log1p(-p);
+    for(uint64_t k = 0; k < N; ++k) {
+        auto const skip = std::floor(std::log1p(-to_unit_interval(gen())) / log_q);
+        if(skip >= static_cast<double>(N - k)) { return; }
+        auto const s = static_cast<uint64_t>(skip);
+        if(s >= N - k) { return; }
+        k += s;
+        fun(k);
+    }
+}
+
+// calls fun(k) for m distinct k from [0, N) chosen uniformly, in increasing order, expected O(m) time:
+// Bernoulli sample of slightly bigger expected size is drawn by geometric skipping (redrawn in rare
+// case it is too small), then uniformly chosen surplus is dropped; memory access is sequential
+template<typename Fun>
+void sample_indices(uint64_t N, uint64_t m, gen_type & gen, Fun && fun) {
+    assume(m <= N);
+    if(m == 0) { return; }
+    auto const expected = static_cast<double>(m) + 3 * std::sqrt(static_cast<double>(m)) + 16; // NOLINT(*-magic-numbers)
+    auto const p = std::min(1.0, expected / static_cast<double>(N));
+    std::vector<uint64_t> sample;
+    sample.reserve(static_cast<std::size_t>(std::min(expected + 3 * std::sqrt(expected), static_cast<double>(N)))); // NOLINT(*-magic-numbers)
+    do {
+        sample.clear();
+        bernoulli_indices(N, p, gen, [&sample](uint64_t k) { sample.push_back(k); });
+    } while(sample.size() < m);
+    // Floyd's algorithm for positions to drop
+    auto const count = sample.size();
+    IndexSet dropped(count - m);
+    for(auto j = m; j < count; ++j) {
+        auto const t = uni_dist<uint64_t>::gen(0, j, gen);
+        if(!dropped.insert(t)) { dropped.insert(j); }
+    }
+    for(std::size_t i = 0; i < count; ++i) {
+        if(!dropped.contains(i)) { fun(sample[i]); }
+    }
+}
+
+// same indices and final state of gen as sample_indices, but O(sqrt(m)) memory: sample is only counted,
+// surplus positions are chosen, then the same sample is drawn again from saved copy of gen, skipping them
+template<typename Fun>
+void sample_indices_replay(uint64_t N, uint64_t m, gen_type & gen, Fun && fun) {
+    assume(m <= N);
+    if(m == 0) { return; }
+    auto const expected = static_cast<double>(m) + 3 * std::sqrt(static_cast<double>(m)) + 16; // NOLINT(*-magic-numbers)
+    auto const p = std::min(1.0, expected / static_cast<double>(N));
+    gen_type start = gen;
+    uint64_t count = 0;
+    do {
+        start = gen;
+        count = 0;
+        bernoulli_indices(N, p, gen, [&count](uint64_t /*unused*/) { ++count; });
+    } while(count < m);
+    IndexSet dropped(count - m);
+    for(auto j = m; j < count; ++j) {
+        auto const t = uni_dist<uint64_t>::gen(0, j, gen);
+        if(!dropped.insert(t)) { dropped.insert(j); }
+    }
+    uint64_t position = 0;
+    bernoulli_indices(N, p, start, [&](uint64_t k) {
+        if(!dropped.contains(position++)) { fun(k); }
+    });
+}
+
+} /* namespace detail */
+
 /* CRTP, assumes Derived has 'generator()' method/field */
 template<typename Derived>
 class RngUtilities {
@@ -249,10 +1006,53 @@ public:
     int64_t randLong(int64_t from, int64_t to) {
         return uni_dist<int64_t>::gen(from, to, gen());
     }
+
+    // get n random int32 in [from:to], inclusive
+    std::vector<int32_t> randInts(std::size_t n, int32_t from, int32_t to) {
+        std::vector<int32_t> res(n);
+        uni_dist<int32_t>::fill(from, to, res.data(), n, gen());
+        return res;
+    }
+
+    // get n random int64 in [from:to], inclusive
+    std::vector<int64_t> randLongs(std::size_t n, int64_t from, int64_t to) {
+        std::vector<int64_t> res(n);
+        uni_dist<int64_t>::fill(from, to, res.data(), n, gen());
+        return res;
+    }
 };
 
 /* ==================== graph.hpp ====================*/
 
+using edge_list_t = std::vector<std::pair<uint, uint>>;
+
+namespace detail {
+
+// union-find with path halving, join(a, b) keeps representative of a
+class DisjointSets {
+    std::vector<uint> parent;
+
+public:
+    explicit DisjointSets(std::size_t n) :
+      parent(n) {
+        std::iota(parent.begin(), parent.end(), 0U);
+    }
+
+    [[nodiscard]] uint find(uint v) {
+        while(parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    void join(uint a, uint b) {
+        parent[find(b)] = find(a);
+    }
+};
+
+} /* namespace detail */
+
 class Graph {
     using container_t = std::vector<std::vector<uint>>;
     using edges_container_t = std::vector<std::pair<uint, uint>>;
@@ -264,6 +1064,14 @@ public:
     explicit Graph(container_t::size_type n) :
       g{n} {}
 
+    template<typename List>
+    Graph(container_t::size_type n, List const & edges) :
+      g{n} {
+        for(auto [a, b] : edges) {
+            addEdge(a, b);
+        }
+    }
+
     [[nodiscard]] std::vector<uint> & operator[](uint i) {
         return g[i];
     }
@@ -279,31 +1087,81 @@ public:
         }
     }
 
-    void permute(gen_type & gen) {
+    // relabels vertices in place: ids in lists are mapped and lists are moved to new positions
+    // by following cycles of permutation, so no list is reallocated
+    // without shuffling neighbours, lists keep order of their (relabelled) elements
+    void permute(gen_type & gen, bool shuffle_neighbours = true) {
         auto const n = g.size();
-        auto const per = get_permutation(n, gen);
-        Graph new_G(g.size());
-        for(uint w = 0; w < n; ++w) {
-            for(auto v : (*this)[w]) {
-                new_G[per[w]].push_back(per[v]);
+        auto per = get_permutation(n, gen);
+        for(auto & V : g) {
+            for(auto & v : V) {
+                v = per[v];
             }
         }
         for(uint w = 0; w < n; ++w) {
-            shuffle_sequence(std::begin(new_G[w]), std::end(new_G[w]), gen);
+            while(per[w] != w) {
+                auto const target = per[w];
+                std::swap(g[w], g[target]);
+                std::swap(per[w], per[target]);
+            }
+        }
+        if(shuffle_neighbours) {
+            for(auto & V : g) {
+                shuffle_sequence(std::begin(V), std::end(V), gen);
+            }
         }
-        *this = std::move(new_G);
     }
 
+    // b is merged into a and left isolated: edge a-b becomes loop at a, loop at b is dropped,
+    // b is removed from lists of its neighbours and a is appended to them
+    // touches only lists of b, a and neighbours of b
     int contract(int a, int b) {
         if(a == b) { return a; }
-        for(auto v : g[b]) {
-            addEdge(a, v);
+        auto const ua = static_cast<uint>(a);
+        auto const ub = static_cast<uint>(b);
+        auto const neighbours = std::move(g[ub]);
+        g[ub].clear();
+        for(auto v : neighbours) {
+            if(v == ub) { continue; }
+            g[ua].push_back(v);
+            if(v != ua) {
+                g[v].resize(std::remove(g[v].begin(), g[v].end(), ub) - g[v].begin());
+                g[v].push_back(ua);
+            }
+        }
+        g[ua].resize(std::remove(g[ua].begin(), g[ua].end(), ub) - g[ua].begin());
+        return a;
+    }
+
+    // contracts all pairs (a, b) at once in O(V + E): vertices connected by pairs are merged
+    // into one, like after contracting pairs one by one, but transitively (contracting (a, b) and
+    // (c, b) merges a, b and c). Pairs are joined in order and (a, b) makes representative of
+    // a's class represent the merged one, so after (a, b) and (c, b) it is c. Other vertices are
+    // left isolated; all loops and multi-edges are kept, also loops that contract(a, b) drops.
+    // Returns representative of every vertex.
+    template<typename List>
+    std::vector<uint> contract(List const & pairs) {
+        auto const n = size();
+        detail::DisjointSets sets(n);
+        for(auto [a, b] : pairs) {
+            sets.join(a, b);
+        }
+        std::vector<uint> representative(n);
+        for(auto i = 0U; i < n; ++i) {
+            representative[i] = sets.find(i);
         }
-        g[b].clear();
+        auto const edges = getEdges();
         for(auto & V : g) {
-            V.resize(remove(V.begin(), V.end(), b) - V.begin());
+            V.clear();
         }
-        return a;
+        for(auto [a, b] : edges) {
+            addEdge(representative[a], representative[b]);
+        }
+        return representative;
+    }
+
+    std::vector<uint> contract(std::initializer_list<std::pair<uint, uint>> const & pairs) {
+        return contract<std::initializer_list<std::pair<uint, uint>>>(pairs);
     }
 
     void makeSimple() {
@@ -369,34 +1227,339 @@ public:
     }
 };
 
-template<typename List>
-Graph merge(Graph const & ag, Graph const & bg, List const & new_edges) {
-    auto const As = ag.size();
-    auto const Bs = bg.size();
-    Graph R(As + Bs);
-    for(auto [a, b] : ag.getEdges()) {
-        R.addEdge(a, b);
-    }
-    for(auto [a, b] : bg.getEdges()) {
-        R.addEdge(As + a, As + b);
-    }
-    for(auto [a, b] : new_edges) {
-        R.addEdge(a, As + b);
-    }
-    return R;
-}
+/* Immutable graph in compressed sparse row form: neighbours of vertex w are stored in
+ * neighbours[offsets[w]], ..., neighbours[offsets[w + 1] - 1]. Whole graph lives in two arrays,
+ * so it is much cheaper to build and iterate than Graph when there are millions of vertices.
+ * Iteration interface is the same as in Graph, neighbours are in the same order as in Graph
+ * built from the same edges. */
+class CsrGraph {
+public:
+    class NeighbourRange {
+        uint const * first;
+        uint const * last;
 
-Graph merge(Graph const & ag, Graph const & bg, std::initializer_list<std::pair<int, int>> const & new_edges = {}) {
+    public:
+        NeighbourRange(uint const * first, uint const * last) noexcept :
+          first{first}, last{last} {}
+
+        [[nodiscard]] uint const * begin() const noexcept {
+            return first;
+        }
+
+        [[nodiscard]] uint const * end() const noexcept {
+            return last;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return static_cast<std::size_t>(last - first);
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return first == last;
+        }
+
+        [[nodiscard]] uint operator[](std::size_t i) const noexcept {
+            return first[i];
+        }
+    };
+
+    class VertexIterator {
+        CsrGraph const * graph;
+        uint vertex;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = NeighbourRange;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = NeighbourRange;
+
+        VertexIterator(CsrGraph const * graph, uint vertex) noexcept :
+          graph{graph}, vertex{vertex} {}
+
+        [[nodiscard]] NeighbourRange operator*() const noexcept {
+            return (*graph)[vertex];
+        }
+
+        VertexIterator & operator++() noexcept {
+            ++vertex;
+            return *this;
+        }
+
+        VertexIterator operator++(int) noexcept {
+            auto res = *this;
+            ++vertex;
+            return res;
+        }
+
+        [[nodiscard]] bool operator==(VertexIterator const & x) const noexcept {
+            return vertex == x.vertex;
+        }
+
+        [[nodiscard]] bool operator!=(VertexIterator const & x) const noexcept {
+            return vertex != x.vertex;
+        }
+    };
+
+private:
+    std::vector<std::size_t> offsets;
+    std::vector<uint> neighbours{};
+
+public:
+    CsrGraph() :
+      offsets(1, 0) {}
+
+    // counting sort of edge endpoints, loop (a, a) is stored once like in Graph::addEdge
+    template<typename List>
+    CsrGraph(std::size_t n, List const & edges) :
+      offsets(n + 2, 0) {
+        for(auto [a, b] : edges) {
+            ++offsets[a + 2];
+            if(a != b) { ++offsets[b + 2]; }
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        neighbours.resize(offsets.back());
+        // offsets[w + 1] is the first free position of w, after the pass it is the end of w
+        for(auto [a, b] : edges) {
+            neighbours[offsets[a + 1]++] = b;
+            if(a != b) { neighbours[offsets[b + 1]++] = a; }
+        }
+        offsets.pop_back();
+    }
+
+    CsrGraph(std::size_t n, std::initializer_list<std::pair<uint, uint>> const & edges) :
+      CsrGraph(n, std::vector<std::pair<uint, uint>>(edges)) {}
+
+    explicit CsrGraph(Graph const & G) :
+      offsets(G.size() + 1, 0) {
+        auto const n = G.size();
+        for(auto i = 0U; i < n; ++i) {
+            offsets[i + 1] = offsets[i] + G[i].size();
+        }
+        neighbours.reserve(offsets.back());
+        for(auto const & V : G) {
+            neighbours.insert(neighbours.end(), V.begin(), V.end());
+        }
+    }
+
+    [[nodiscard]] NeighbourRange operator[](uint i) const noexcept {
+        return {neighbours.data() + offsets[i], neighbours.data() + offsets[i + 1]};
+    }
+
+    // same result as Graph::permute on equal Graph with the same generator
+    void permute(gen_type & gen, bool shuffle_neighbours = true) {
+        auto const n = size();
+        auto const per = get_permutation(n, gen);
+        std::vector<std::size_t> new_offsets(n + 1, 0);
+        for(uint w = 0; w < n; ++w) {
+            new_offsets[per[w] + 1] = offsets[w + 1] - offsets[w];
+        }
+        std::partial_sum(new_offsets.begin(), new_offsets.end(), new_offsets.begin());
+        std::vector<uint> new_neighbours(neighbours.size());
+        for(uint w = 0; w < n; ++w) {
+            auto const V = (*this)[w];
+            std::transform(V.begin(), V.end(), new_neighbours.begin() + new_offsets[per[w]], [&per](uint v) { return per[v]; });
+        }
+        for(uint w = 0; w < n && shuffle_neighbours; ++w) {
+            shuffle_sequence(new_neighbours.begin() + new_offsets[w], new_neighbours.begin() + new_offsets[w + 1], gen);
+        }
+        offsets = std::move(new_offsets);
+        neighbours = std::move(new_neighbours);
+    }
+
+    [[nodiscard]] VertexIterator begin() const noexcept {
+        return {this, 0U};
+    }
+
+    [[nodiscard]] VertexIterator end() const noexcept {
+        return {this, static_cast<uint>(size())};
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return offsets.size() - 1;
+    }
+
+    [[nodiscard]] edge_list_t getEdges() const {
+        edge_list_t res;
+        auto const n = size();
+        for(auto a = 0U; a < n; a++) {
+            for(auto b : (*this)[a]) {
+                if(a <= b) {
+                    res.emplace_back(a, b);
+                }
+            }
+        }
+        return res;
+    }
+};
+
+/* Graph stored only as list of edges, for generators which only print edges:
+ * no adjacency lists are built, relabelling and printing work directly on the array.
+ * Edges are kept in insertion order and orientation; toGraph() and toCsr() build adjacency form
+ * when neighbours are needed. */
+class EdgeListGraph {
+    std::size_t n;
+    edge_list_t edges{};
+
+public:
+    EdgeListGraph() :
+      EdgeListGraph(0) {}
+    explicit EdgeListGraph(std::size_t n) :
+      n{n} {}
+    EdgeListGraph(std::size_t n, edge_list_t edges) :
+      n{n}, edges{std::move(edges)} {}
+    explicit EdgeListGraph(Graph const & G) :
+      n{G.size()}, edges{G.getEdges()} {}
+
+    void addEdge(uint a, uint b) {
+        edges.emplace_back(a, b);
+    }
+
+    // vertex v becomes label[v]
+    void relabel(std::vector<uint> const & label) {
+        for(auto & [a, b] : edges) {
+            a = label[a];
+            b = label[b];
+        }
+    }
+
+    // random labels, random order of edges and random orientation of each edge
+    void permute(gen_type & gen) {
+        relabel(get_permutation(n, gen));
+        shuffle_sequence(std::begin(edges), std::end(edges), gen);
+        constexpr std::size_t BITS = 64;
+        uint64_t word{};
+        for(std::size_t i = 0; i < edges.size(); ++i) {
+            if(i % BITS == 0) { word = gen(); }
+            if((word >> (i % BITS) & 1U) != 0) {
+                std::swap(edges[i].first, edges[i].second);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return n;
+    }
+
+    [[nodiscard]] edge_list_t const & getEdges() const noexcept {
+        return edges;
+    }
+
+    [[nodiscard]] Graph toGraph() const {
+        return Graph(n, edges);
+    }
+
+    [[nodiscard]] CsrGraph toCsr() const {
+        return CsrGraph(n, edges);
+    }
+};
+
+namespace detail {
+
+// graphs with adjacency lists
+template<typename T>
+inline constexpr bool is_graph_v = std::is_same_v<T, Graph> || std::is_same_v<T, CsrGraph>; //NOLINT(readability-identifier-naming)
+
+// calls fun(a, b) for every edge once, for adjacency graphs in order of getEdges()
+template<typename GraphT, typename Fun>
+void for_each_edge(GraphT const & g, Fun && fun) {
+    if constexpr(is_graph_v<GraphT>) {
+        auto const n = g.size();
+        for(auto a = 0U; a < n; a++) {
+            for(auto b : g[a]) {
+                if(a <= b) {
+                    fun(a, b);
+                }
+            }
+        }
+    } else {
+        for(auto [a, b] : g.getEdges()) {
+            fun(a, b);
+        }
+    }
+}
+
+} /* namespace detail */
+
+/* View of graph with vertex v named label[v]. Labels are applied only when edges are printed,
+ * so graph is neither copied nor modified; it has to outlive the view.
+ * Edges are printed in order of the original graph. */
+template<typename GraphT>
+class RelabelledGraph {
+    GraphT const & g;
+    std::vector<uint> labels;
+
+public:
+    RelabelledGraph(GraphT const & g, std::vector<uint> labels) :
+      g{g}, labels{std::move(labels)} {}
+
+    // random labels
+    RelabelledGraph(GraphT const & g, gen_type & gen) :
+      RelabelledGraph(g, get_permutation(g.size(), gen)) {}
+
+    [[nodiscard]] GraphT const & graph() const noexcept {
+        return g;
+    }
+
+    [[nodiscard]] std::vector<uint> const & label() const noexcept {
+        return labels;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return g.size();
+    }
+};
+
+template<typename List>
+Graph merge(Graph const & ag, Graph const & bg, List const & new_edges) {
+    auto const As = ag.size();
+    auto const Bs = bg.size();
+    Graph R(As + Bs);
+    for(auto [a, b] : ag.getEdges()) {
+        R.addEdge(a, b);
+    }
+    for(auto [a, b] : bg.getEdges()) {
+        R.addEdge(As + a, As + b);
+    }
+    for(auto [a, b] : new_edges) {
+        R.addEdge(a, As + b);
+    }
+    return R;
+}
+
+Graph merge(Graph const & ag, Graph const & bg, std::initializer_list<std::pair<int, int>> const & new_edges = {}) {
+    return merge<std::initializer_list<std::pair<int, int>>>(ag, bg, new_edges);
+}
+
+template<typename List>
+EdgeListGraph merge(EdgeListGraph const & ag, EdgeListGraph const & bg, List const & new_edges) {
+    auto const As = static_cast<uint>(ag.size());
+    edge_list_t edges;
+    edges.reserve(ag.getEdges().size() + bg.getEdges().size() + std::size(new_edges));
+    edges.insert(edges.end(), ag.getEdges().begin(), ag.getEdges().end());
+    for(auto [a, b] : bg.getEdges()) {
+        edges.emplace_back(As + a, As + b);
+    }
+    for(auto [a, b] : new_edges) {
+        edges.emplace_back(a, As + b);
+    }
+    return {ag.size() + bg.size(), std::move(edges)};
+}
+
+EdgeListGraph merge(EdgeListGraph const & ag, EdgeListGraph const & bg, std::initializer_list<std::pair<int, int>> const & new_edges = {}) {
     return merge<std::initializer_list<std::pair<int, int>>>(ag, bg, new_edges);
 }
 
 template<typename List>
 Graph identify(Graph const & ag, Graph const & bg, List const & vertices) {
-    auto As = ag.size();
+    auto const As = static_cast<uint>(ag.size());
     Graph R = merge(ag, bg, {});
+    edge_list_t pairs;
+    pairs.reserve(std::size(vertices));
     for(auto [a, b] : vertices) {
-        R.contract(a, As + b);
+        pairs.emplace_back(a, As + b);
     }
+    R.contract(pairs);
     R.removeIsolated();
     R.makeSimple();
     return R;
@@ -405,14 +1568,73 @@ Graph identify(Graph const & ag, Graph const & bg, List const & vertices) {
 Graph identify(Graph const & ag, Graph const & bg, std::initializer_list<std::pair<int, int>> const & vertices) {
     return identify<std::initializer_list<std::pair<int, int>>>(ag, bg, vertices);
 }
-class Tree : public Generating<Graph> {
+namespace detail {
+
+// default number of edges in one batch of streamBatches
+constexpr std::size_t EDGE_BATCH = std::size_t{1} << 16U;
+
+// stream(f) calls f(a, b) for every edge, consume(edges) gets them in consecutive batches of at most batch edges
+template<typename Stream, typename Consume>
+void stream_batches(Stream && stream, std::size_t batch, Consume && consume) {
+    edge_list_t edges;
+    edges.reserve(batch);
+    stream([&edges, &consume, batch](uint a, uint b) {
+        edges.emplace_back(a, b);
+        if(edges.size() == batch) {
+            consume(std::as_const(edges));
+            edges.clear();
+        }
+    });
+    if(!edges.empty()) { consume(std::as_const(edges)); }
+}
+
+} /* namespace detail */
+
+/* CRTP, assumes Derived has 'generateEdges(gen)' method returning edges of random graph on n vertices
+ * and 'forEachEdge(gen, fun)' method calling fun(a, b) for each of them, in O(n) memory */
+template<typename Derived>
+class RandomGraphBase : public Generating<Graph> {
+protected:
     uint n;
+
+    explicit RandomGraphBase(uint n) :
+      n{n} {}
+
+public:
+    // calls fun(a, b) for every edge of the same graph as generate(gen) would give, edges are not stored
+    template<typename Fun>
+    void streamEdges(gen_type & gen, Fun && fun) const {
+        static_cast<const Derived *>(this)->forEachEdge(gen, std::forward<Fun>(fun));
+    }
+
+    // edges of streamEdges(gen, ...) passed to fun(edge_list_t const &) in batches
+    template<typename Fun>
+    void streamBatches(gen_type & gen, Fun && fun, std::size_t batch = detail::EDGE_BATCH) const {
+        detail::stream_batches([this, &gen](auto && f) { streamEdges(gen, f); }, batch, fun);
+    }
+
+    [[nodiscard]] Graph generate(gen_type & gen) const override {
+        return Graph(n, static_cast<const Derived *>(this)->generateEdges(gen));
+    }
+
+    // same graph as generate(gen) would give
+    [[nodiscard]] CsrGraph generateCsr(gen_type & gen) const {
+        return CsrGraph(n, static_cast<const Derived *>(this)->generateEdges(gen));
+    }
+
+    // same graph as generate(gen) would give
+    [[nodiscard]] EdgeListGraph generateEdgeList(gen_type & gen) const {
+        return {n, static_cast<const Derived *>(this)->generateEdges(gen)};
+    }
+};
+
+class Tree : public RandomGraphBase<Tree> {
     uint range;
 
 public:
     //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
     Tree(uint n, uint range) :
-      n{n}, range{range} {
+      RandomGraphBase{n}, range{range} {
         assume(n >= 1U);
         assume(range >= 1U);
     }
@@ -420,152 +1642,2282 @@ public:
     explicit Tree(uint n) :
       Tree{n, n} {}
 
-    [[nodiscard]] Graph generate(gen_type & gen) const override {
-        Graph G(n);
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
         for(auto i = 1U; i < n; ++i) {
             const auto begin = static_cast<uint>(std::max(0, static_cast<int>(i) - static_cast<int>(range)));
             const auto end = i - 1;
-            G.addEdge(i, uni_dist<uint>::gen(begin, end, gen));
+            fun(i, uni_dist<uint>::gen(begin, end, gen));
         }
-        return G;
     }
-};
 
-template<typename Derived>
-class StaticGraphBase : public Generating<Graph> {
-public:
-    [[nodiscard]] Graph generate(gen_type & gen) const override {
-        Graph G = static_cast<const Derived *>(this)->generate();
-        G.permute(gen);
-        return G;
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(n - 1);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
     }
 };
 
-class Path : public StaticGraphBase<Path> {
-    uint n;
+namespace detail {
 
-public:
-    explicit Path(uint n) :
-      n{n} {
-        assume(n >= 1U);
+// k-th pair (a, b) with b < a in order (1, 0), (2, 0), (2, 1), (3, 0), ...
+inline std::pair<uint, uint> pair_from_index(uint64_t k) {
+    auto a = static_cast<uint64_t>((1.0 + std::sqrt(1.0 + 8.0 * static_cast<double>(k))) / 2.0); // NOLINT(*-magic-numbers)
+    while(a * (a - 1) / 2 > k) {
+        --a;
     }
+    while(a * (a + 1) / 2 <= k) {
+        ++a;
+    }
+    return {static_cast<uint>(a), static_cast<uint>(k - a * (a - 1) / 2)};
+}
 
-    using StaticGraphBase<Path>::generate;
+// pair_from_index for increasing k, amortized O(1) per call
+struct pair_cursor {
+    uint64_t a{1};
+    uint64_t row{0}; // index of (a, 0)
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
-        for(auto w = 0U; w < n - 1; ++w) {
-            G.addEdge(w, w + 1);
+    [[nodiscard]] std::pair<uint, uint> operator()(uint64_t k) noexcept {
+        while(k >= row + a) {
+            row += a;
+            ++a;
         }
-        return G;
+        return {static_cast<uint>(a), static_cast<uint>(k - row)};
     }
 };
 
-class Clique : public StaticGraphBase<Clique> {
-    uint n;
+inline uint64_t pairs_count(uint n) {
+    return static_cast<uint64_t>(n) * (n - 1) / 2;
+}
+
+// edge array for expected number of edges, with slack of a few standard deviations
+inline edge_list_t reserve_edges(double expected) {
+    edge_list_t edges;
+    edges.reserve(static_cast<std::size_t>(expected + 4 * std::sqrt(expected) + 16)); // NOLINT(*-magic-numbers)
+    return edges;
+}
+
+} /* namespace detail */
+
+/* Erdos-Renyi graph G(n, p): every edge independently with probability p.
+ * Geometric skipping over pairs (Batagelj, Brandes), expected O(n + m) time. */
+class Gnp : public RandomGraphBase<Gnp> {
+    double p;
 
 public:
-    explicit Clique(uint n) :
-      n{n} {
+    Gnp(uint n, double p) :
+      RandomGraphBase{n}, p{p} {
         assume(n >= 1U);
+        assume(0 <= p && p <= 1);
     }
 
-    using StaticGraphBase<Clique>::generate;
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::bernoulli_indices(detail::pairs_count(n), p, gen, [&fun, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            auto const [a, b] = cursor(k);
+            fun(a, b);
+        });
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
-        for(uint i = 0; i < n; i++) {
-            for(uint j = i + 1; j < n; j++) {
-                G.addEdge(i, j);
-            }
-        }
-        return G;
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        auto edges = detail::reserve_edges(p * static_cast<double>(detail::pairs_count(n)));
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
     }
 };
 
-class Cycle : public StaticGraphBase<Cycle> {
-    uint n;
+/* Erdos-Renyi graph G(n, m): m distinct edges chosen uniformly, expected O(n + m) time.
+ * Edges come sorted by larger endpoint; vertex labels are uniformly random already. */
+class Gnm : public RandomGraphBase<Gnm> {
+    uint64_t m;
 
 public:
-    explicit Cycle(uint n) :
-      n{n} {
-        assume(n >= 3U);
+    Gnm(uint n, uint64_t m) :
+      RandomGraphBase{n}, m{m} {
+        assume(n >= 1U);
+        assume(m <= detail::pairs_count(n));
     }
 
-    using StaticGraphBase<Cycle>::generate;
+    // sample is drawn twice instead of being stored, so it is slower than generateEdges
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::sample_indices_replay(detail::pairs_count(n), m, gen, [&fun, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            auto const [a, b] = cursor(k);
+            fun(a, b);
+        });
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
-        for(auto i = 0U; i < n - 1; i++) {
-            G.addEdge(i, i + 1);
-        }
-        G.addEdge(n - 1, 0);
-        return G;
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(m);
+        detail::sample_indices(detail::pairs_count(n), m, gen, [&edges, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            edges.push_back(cursor(k));
+        });
+        return edges;
     }
 };
 
-class Star : public StaticGraphBase<Star> {
-    uint n;
+/* Random bipartite graph with parts 0, ..., a - 1 and a, ..., a + b - 1,
+ * each of a * b edges independently with probability p, expected O(a + b + m) time. */
+class BipartiteGnp : public RandomGraphBase<BipartiteGnp> {
+    uint a;
+    uint b;
+    double p;
 
 public:
-    explicit Star(uint n) :
-      n{n} {
-        assume(n >= 1U);
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BipartiteGnp(uint a, uint b, double p) :
+      RandomGraphBase{a + b}, a{a}, b{b}, p{p} {
+        assume(a >= 1U && b >= 1U);
+        assume(0 <= p && p <= 1);
     }
 
-    using StaticGraphBase<Star>::generate;
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::bernoulli_indices(static_cast<uint64_t>(a) * b, p, gen, [&](uint64_t k) {
+            fun(static_cast<uint>(k / b), static_cast<uint>(a + k % b));
+        });
+    }
 
-    [[nodiscard]] Graph generate() const {
-        Graph G(n);
-        for(auto i = 1U; i < n; i++) {
-            G.addEdge(0, i + 1);
-        }
-        return G;
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        auto edges = detail::reserve_edges(p * static_cast<double>(a) * static_cast<double>(b));
+        forEachEdge(gen, [&edges](uint u, uint v) { edges.emplace_back(u, v); });
+        return edges;
     }
 };
 
-/* ==================== output.hpp ====================*/
+/* Random bipartite graph with parts 0, ..., a - 1 and a, ..., a + b - 1 and exactly m distinct edges. */
+class BipartiteGnm : public RandomGraphBase<BipartiteGnm> {
+    uint a;
+    uint b;
+    uint64_t m;
 
-class Output : public std::ostream {
 public:
-    explicit Output(std::ostream && stream) :
-      std::ostream(std::move(stream)) {}
-    explicit Output(std::ostream & stream) {
-        set(stream);
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BipartiteGnm(uint a, uint b, uint64_t m) :
+      RandomGraphBase{a + b}, a{a}, b{b}, m{m} {
+        assume(a >= 1U && b >= 1U);
+        assume(m <= static_cast<uint64_t>(a) * b);
     }
-    Output() = default;
-    Output(Output const &) = delete;
-    Output(Output &&) = delete;
-    Output & operator=(Output const &) = delete;
-    Output & operator=(Output &&) = delete;
-    ~Output() override = default;
 
-    void set(std::ostream & stream) {
-        rdbuf(stream.rdbuf());
+    // sample is drawn twice instead of being stored, so it is slower than generateEdges
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::sample_indices_replay(static_cast<uint64_t>(a) * b, m, gen, [&](uint64_t k) {
+            fun(static_cast<uint>(k / b), static_cast<uint>(a + k % b));
+        });
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(m);
+        detail::sample_indices(static_cast<uint64_t>(a) * b, m, gen, [&](uint64_t k) {
+            edges.emplace_back(static_cast<uint>(k / b), static_cast<uint>(a + k % b));
+        });
+        return edges;
     }
 };
 
-void printEdges(std::ostream & s, Graph const & g, int shift = 0) {
-    for(auto [a, b] : g.getEdges()) {
-        s << a + shift << ' ' << b + shift << '\n';
+// calls fun(a, b) for edges of tree with given Prufer code (values from [0, n), n = code.size() + 2) in O(n),
+// without heap: the smallest leaf is tracked by pointer which only moves forward
+template<typename Fun>
+void decode_prufer(std::vector<uint> const & code, Fun && fun) {
+    auto const n = code.size() + 2;
+    std::vector<uint> degree(n, 1);
+    for(auto x : code) {
+        ++degree[x];
+    }
+    uint ptr = 0;
+    while(degree[ptr] != 1) {
+        ++ptr;
+    }
+    auto leaf = ptr;
+    for(auto x : code) {
+        fun(leaf, x);
+        if(--degree[x] == 1 && x < ptr) {
+            leaf = x; // new leaf is smaller than any other, take it right away
+        } else {
+            do {
+                ++ptr;
+            } while(degree[ptr] != 1);
+            leaf = ptr;
+        }
     }
+    fun(leaf, static_cast<uint>(n - 1));
+}
+
+inline edge_list_t decode_prufer(std::vector<uint> const & code) {
+    edge_list_t edges;
+    edges.reserve(code.size() + 1);
+    decode_prufer(code, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+    return edges;
 }
 
-void printEdgesAsTree(std::ostream & s, Graph const & g, int shift = 0) {
-    std::vector<int> par(g.size());
-    auto dfs = [&g, &par](uint w, uint p, auto && self) -> void {
-        par[w] = p;
-        for(auto v : g[w]) {
-            if(v != p) {
-                self(v, w, self);
-            }
-        }
-    };
-    dfs(0, -1, dfs);
-    for(uint i = 1; i < g.size(); i++) {
-        s << par[i] + shift << '\n';
+/* Tree chosen uniformly from all n^(n - 2) labelled trees, decoded from random Prufer code in O(n). */
+class UniformTree : public RandomGraphBase<UniformTree> {
+public:
+    explicit UniformTree(uint n) :
+      RandomGraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        if(n == 1) { return; }
+        std::vector<uint> code(n - 2);
+        uni_dist<uint>(0, n - 1).fill(code.data(), code.size(), gen);
+        decode_prufer(code, std::forward<Fun>(fun));
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        if(n == 1) { return {}; }
+        std::vector<uint> code(n - 2);
+        uni_dist<uint>(0, n - 1).fill(code.data(), code.size(), gen);
+        return decode_prufer(code);
+    }
+};
+
+/* Path 0, 1, ..., spine - 1 with each of the other vertices attached to random vertex of the path.
+ * Like in Tree, labels follow the structure. */
+class Caterpillar : public RandomGraphBase<Caterpillar> {
+    uint spine;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Caterpillar(uint n, uint spine) :
+      RandomGraphBase{n}, spine{spine} {
+        assume(1U <= spine && spine <= n);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        for(auto i = 1U; i < spine; ++i) {
+            fun(i - 1, i);
+        }
+        std::vector<uint> legs(n - spine);
+        uni_dist<uint>(0, spine - 1).fill(legs.data(), legs.size(), gen);
+        for(auto i = spine; i < n; ++i) {
+            fun(legs[i - spine], i);
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(n - 1);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+/* Random tree rooted at 0 of height at most depth: every vertex is attached to a random earlier
+ * vertex among these of depth smaller than depth. Labels follow the structure (parent < child). */
+class BoundedDepthTree : public RandomGraphBase<BoundedDepthTree> {
+    uint depth;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BoundedDepthTree(uint n, uint depth) :
+      RandomGraphBase{n}, depth{depth} {
+        assume(n >= 1U);
+        assume(depth >= 1U || n == 1U);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        std::vector<uint> level(n, 0);
+        std::vector<uint> open{0}; // vertices which can get children
+        open.reserve(n);
+        for(auto i = 1U; i < n; ++i) {
+            auto const parent = open[uni_dist<std::size_t>::gen(0, open.size() - 1, gen)];
+            fun(parent, i);
+            level[i] = level[parent] + 1;
+            if(level[i] < depth) {
+                open.push_back(i);
+            }
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(n - 1);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+namespace detail {
+
+// index of pair (a, b) in order of pair_from_index, a != b
+inline uint64_t index_of_pair(uint a, uint b) {
+    if(a < b) { std::swap(a, b); }
+    return static_cast<uint64_t>(a) * (a - 1) / 2 + b;
+}
+
+// LSD radix sort by 16 bits, one pass per 16 significant bits of the maximum;
+// short vectors, for which counting array would dominate, are sorted with std::sort
+inline void radix_sort(std::vector<uint64_t> & values) {
+    constexpr unsigned BITS = 16;
+    constexpr std::size_t BUCKETS = std::size_t{1} << BITS;
+    if(values.size() < BUCKETS) {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+    auto const max = values.empty() ? 0 : *std::max_element(values.begin(), values.end());
+    std::vector<uint64_t> buffer(values.size());
+    std::vector<std::size_t> count(BUCKETS);
+    for(unsigned shift = 0; shift < 64U && (max >> shift) != 0; shift += BITS) {
+        std::fill(count.begin(), count.end(), 0);
+        for(auto v : values) {
+            ++count[(v >> shift) & (BUCKETS - 1)];
+        }
+        std::exclusive_scan(count.begin(), count.end(), count.begin(), std::size_t{0});
+        for(auto v : values) {
+            buffer[count[(v >> shift) & (BUCKETS - 1)]++] = v;
+        }
+        values.swap(buffer);
+    }
+}
+
+} /* namespace detail */
+
+/* Connected simple graph with n vertices and exactly m edges: uniformly random spanning tree
+ * (UniformTree) and m - n + 1 other edges chosen uniformly from the remaining pairs.
+ * Extra edges are sampled by rank among non-tree pairs, so there is no rejection, expected O(n + m)
+ * time and memory also for dense graphs. Edges are returned in random order. */
+class ConnectedGraph : public RandomGraphBase<ConnectedGraph> {
+    uint64_t m;
+
+    // calls fun(a, b) for the m - n + 1 non-tree edges in order of pair index,
+    // tree_edges are read before first call, so fun may append to them
+    template<bool Replay, typename Fun>
+    void forEachExtraEdge(edge_list_t const & tree_edges, gen_type & gen, Fun && fun) const {
+        std::vector<uint64_t> tree(tree_edges.size());
+        std::transform(tree_edges.begin(), tree_edges.end(), tree.begin(), [](auto e) { return detail::index_of_pair(e.first, e.second); });
+        detail::radix_sort(tree);
+        // r-th non-tree pair is k = r + j, where j is number of tree pairs smaller than k
+        std::size_t j = 0;
+        auto on_rank = [&, cursor = detail::pair_cursor{}](uint64_t r) mutable {
+            while(j < tree.size() && tree[j] <= r + j) {
+                ++j;
+            }
+            auto const [a, b] = cursor(r + j);
+            fun(a, b);
+        };
+        auto const N = detail::pairs_count(n) - tree.size();
+        if constexpr(Replay) {
+            detail::sample_indices_replay(N, m - tree.size(), gen, on_rank);
+        } else {
+            detail::sample_indices(N, m - tree.size(), gen, on_rank);
+        }
+    }
+
+public:
+    ConnectedGraph(uint n, uint64_t m) :
+      RandomGraphBase{n}, m{m} {
+        assume(n >= 1U);
+        assume(n - 1 <= m && m <= detail::pairs_count(n));
+    }
+
+    // same edges as generateEdges, but not shuffled: tree edges come first; O(n) memory
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        auto const tree = UniformTree(n).generateEdges(gen);
+        for(auto [a, b] : tree) {
+            fun(a, b);
+        }
+        forEachExtraEdge<true>(tree, gen, fun);
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        auto edges = UniformTree(n).generateEdges(gen);
+        edges.reserve(m);
+        forEachExtraEdge<false>(edges, gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        shuffle_sequence(edges.begin(), edges.end(), gen);
+        return edges;
+    }
+};
+
+/* Random stacked (Apollonian) triangulation: starts with triangle 0, 1, 2 and puts every next vertex
+ * into a face chosen uniformly, joining it with three corners of the face. Result is maximal planar
+ * graph with 3n - 6 edges, O(n) time. Labels follow the structure, 0, 1, 2 is the outer face. */
+class RandomTriangulation : public RandomGraphBase<RandomTriangulation> {
+public:
+    explicit RandomTriangulation(uint n) :
+      RandomGraphBase{n} {
+        assume(n >= 3U);
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        fun(0U, 1U);
+        fun(1U, 2U);
+        fun(2U, 0U);
+        std::vector<std::array<uint, 3>> faces{{0, 1, 2}};
+        faces.reserve(2 * static_cast<std::size_t>(n) - 5);
+        for(auto v = 3U; v < n; ++v) {
+            auto const f = uni_dist<std::size_t>::gen(0, faces.size() - 1, gen);
+            auto const [a, b, c] = faces[f];
+            fun(a, v);
+            fun(b, v);
+            fun(c, v);
+            faces[f] = {a, b, v};
+            faces.push_back({b, c, v});
+            faces.push_back({c, a, v});
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(3 * static_cast<std::size_t>(n) - 6);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+using point_list_t = std::vector<std::pair<uint, uint>>;
+
+namespace detail {
+
+/* Calls fun(i, j), i < j, for every pair of points within Euclidean distance radius.
+ * Points are counting-sorted into buckets of spatial hash of cells radius x radius, so only points
+ * from 9 neighbouring cells are compared: expected O(n + number of pairs closer than 2 radius).
+ * Points are visited in bucket order, coordinates are copied in that order for sequential access. */
+template<typename Fun>
+void for_each_close_pair(point_list_t const & points, uint radius, Fun && fun) {
+    constexpr uint64_t MULTIPLIER_X = 0x9E3779B97F4A7C15; // NOLINT(*-magic-numbers)
+    constexpr uint64_t MULTIPLIER_Y = 0xC2B2AE3D27D4EB4F; // NOLINT(*-magic-numbers)
+    assume(radius >= 1U && radius < (1U << 31U));
+    auto const n = points.size();
+    unsigned bits = 1;
+    while((std::size_t{1} << bits) < n) {
+        ++bits;
+    }
+    auto const bucket = [bits](uint64_t cx, uint64_t cy) {
+        return static_cast<std::size_t>((cx * MULTIPLIER_X ^ cy * MULTIPLIER_Y) >> (64U - bits));
+    };
+    std::vector<std::size_t> offsets((std::size_t{1} << bits) + 1, 0);
+    for(auto [x, y] : points) {
+        ++offsets[bucket(x / radius, y / radius) + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<uint> index(n);
+    point_list_t sorted(n);
+    {
+        auto position = offsets;
+        for(uint i = 0; i < n; ++i) {
+            auto const k = position[bucket(points[i].first / radius, points[i].second / radius)]++;
+            index[k] = i;
+            sorted[k] = points[i];
+        }
+    }
+    // radius < 2^31, so r2 < 2^62 and sum of two squares not greater than it does not overflow
+    auto const r2 = static_cast<uint64_t>(radius) * radius;
+    auto const diff = [](uint a, uint b) { return a > b ? a - b : b - a; };
+    for(std::size_t k = 0; k < n; ++k) {
+        auto const [x, y] = sorted[k];
+        uint64_t const cx = x / radius;
+        uint64_t const cy = y / radius;
+        for(auto nx = cx == 0 ? cx : cx - 1; nx <= cx + 1; ++nx) {
+            for(auto ny = cy == 0 ? cy : cy - 1; ny <= cy + 1; ++ny) {
+                auto const b = bucket(nx, ny);
+                for(auto l = std::max(offsets[b], k + 1); l < offsets[b + 1]; ++l) {
+                    auto const [u, v] = sorted[l];
+                    // skip other cells hashed to the same bucket, so every pair is found once
+                    if(u / radius != nx || v / radius != ny) { continue; }
+                    auto const dx = static_cast<uint64_t>(diff(x, u));
+                    auto const dy = static_cast<uint64_t>(diff(y, v));
+                    if(dx <= radius && dy <= radius && dx * dx + dy * dy <= r2) {
+                        fun(std::min(index[k], index[l]), std::max(index[k], index[l]));
+                    }
+                }
+            }
+        }
+    }
+}
+
+} /* namespace detail */
+
+// edges between points within Euclidean distance radius, vertex i is points[i]
+inline edge_list_t unitDiskEdges(point_list_t const & points, uint radius) {
+    edge_list_t edges;
+    detail::for_each_close_pair(points, radius, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+    return edges;
+}
+
+/* Unit disk graph: n points with coordinates uniform in [0:range], joined when they are within
+ * distance radius. Neighbours are found by spatial hashing, expected O(n + m) time for uniform points.
+ * generatePoints(gen) followed by unitDiskEdges(points, radius) gives the same graph with coordinates. */
+class UnitDiskGraph : public RandomGraphBase<UnitDiskGraph> {
+    uint range;
+    uint radius;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    UnitDiskGraph(uint n, uint range, uint radius) :
+      RandomGraphBase{n}, range{range}, radius{radius} {
+        assume(n >= 1U);
+        assume(radius >= 1U && radius < (1U << 31U));
+    }
+
+    [[nodiscard]] point_list_t generatePoints(gen_type & gen) const {
+        std::vector<uint> coordinates(2 * static_cast<std::size_t>(n));
+        uni_dist<uint>(0, range).fill(coordinates.data(), coordinates.size(), gen);
+        point_list_t points(n);
+        for(std::size_t i = 0; i < n; ++i) {
+            points[i] = {coordinates[2 * i], coordinates[2 * i + 1]};
+        }
+        return points;
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        detail::for_each_close_pair(generatePoints(gen), radius, std::forward<Fun>(fun));
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        return unitDiskEdges(generatePoints(gen), radius);
+    }
+};
+
+/* Chung-Lu graph with expected degrees d: sum(d) / 2 edges, both endpoints of each drawn independently
+ * with probability d[v] / sum(d) from alias table, O(1) per edge. Loops are dropped, so expected degree
+ * of v is d[v](1 - d[v] / sum(d)). With simple = true repeated edges are dropped as well (first copy
+ * is kept), which needs O(m) memory also when streaming. Labels are those of d, edges in random order. */
+class ChungLu : public RandomGraphBase<ChungLu> {
+    uint64_t m;
+    std::optional<discrete_dist> endpoints; // only when there are edges to draw
+    bool simple;
+
+public:
+    explicit ChungLu(std::vector<uint> const & degrees, bool simple = true) :
+      RandomGraphBase{static_cast<uint>(degrees.size())},
+      m{std::accumulate(degrees.begin(), degrees.end(), uint64_t{0}) / 2},
+      simple{simple} {
+        if(m != 0) { endpoints.emplace(std::vector<uint64_t>(degrees.begin(), degrees.end())); }
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        if(m == 0) { return; }
+        constexpr std::size_t BLOCK = 1024;
+        std::array<uint, 2 * BLOCK> ends{};
+        std::optional<detail::IndexSet> seen;
+        if(simple) { seen.emplace(m); }
+        for(uint64_t done = 0; done < m; done += BLOCK) {
+            auto const count = static_cast<std::size_t>(std::min<uint64_t>(BLOCK, m - done));
+            endpoints->fill(ends.data(), 2 * count, gen);
+            for(std::size_t i = 0; i < count; ++i) {
+                auto const a = ends[2 * i];
+                auto const b = ends[2 * i + 1];
+                if(a == b || (seen.has_value() && !seen->insert(detail::index_of_pair(a, b)))) { continue; }
+                fun(a, b);
+            }
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(m);
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+/* Barabasi-Albert preferential attachment: clique on k + 1 vertices, then every next vertex v is joined
+ * to k distinct earlier vertices, each drawn with probability proportional to its current degree as
+ * a uniform entry of the array of endpoints of all edges so far (Batagelj, Brandes). Repeated targets
+ * are drawn again, O(1) expected per edge. The endpoint array takes O(m) memory also when streaming.
+ * Labels follow the order of arrival, so hubs have small labels. */
+class BarabasiAlbert : public RandomGraphBase<BarabasiAlbert> {
+    uint k;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    BarabasiAlbert(uint n, uint k) :
+      RandomGraphBase{n}, k{k} {
+        assume(k >= 1U);
+        assume(n >= k + 1);
+    }
+
+    [[nodiscard]] uint64_t edgeCount() const noexcept {
+        return detail::pairs_count(k + 1) + static_cast<uint64_t>(n - k - 1) * k;
+    }
+
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        std::vector<uint> ends;
+        ends.reserve(2 * edgeCount());
+        for(auto a = 1U; a <= k; ++a) {
+            for(auto b = 0U; b < a; ++b) {
+                fun(a, b);
+                ends.push_back(a);
+                ends.push_back(b);
+            }
+        }
+        // chosen[t] == v if t is already a target of v
+        std::vector<uint> chosen(n, n);
+        for(auto v = k + 1; v < n; ++v) {
+            auto const size = ends.size();
+            for(auto j = 0U; j < k;) {
+                auto const t = ends[uni_dist<std::size_t>::gen(0, size - 1, gen)];
+                if(chosen[t] == v) { continue; }
+                chosen[t] = v;
+                fun(v, t);
+                ends.push_back(v);
+                ends.push_back(t);
+                ++j;
+            }
+        }
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        edge_list_t edges;
+        edges.reserve(edgeCount());
+        forEachEdge(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+};
+
+/* Simple graph in which vertex v has degree exactly d[v], by configuration model: array of stubs,
+ * v repeated d[v] times, is shuffled once and consecutive stubs are paired. Loops and repeated edges
+ * are then repaired one by one by switching with uniformly chosen good edge: (a, b), (c, d) become
+ * (a, c), (b, d) if neither is a loop nor already present. Edges are kept in a hash set, so everything
+ * is expected O(n + m) as long as max degree is small compared to sqrt(m), when only O(1 + (max degree)^2)
+ * edges need repair. Dense sequences, with more than half of all pairs as edges, are generated as
+ * complement of graph with degrees n - 1 - d[v], in O(n^2) = O(m) time, so e.g. cliques work too.
+ * Sum of degrees must be even; if repairs take more than 64m + 1024 attempts in total (e.g. when d
+ * is not graphical) generation fails like assume. Labels are those of d, edges are in random order. */
+class ConfigurationModel : public RandomGraphBase<ConfigurationModel> {
+    std::vector<uint> degrees;
+    uint64_t m;
+
+    // pairing and repair of sequence with sum of degrees 2m
+    static edge_list_t pairStubs(std::vector<uint> const & degrees, uint64_t m, gen_type & gen, uint64_t & repairs) {
+        std::vector<uint> stubs;
+        stubs.reserve(2 * m);
+        for(uint v = 0; v < degrees.size(); ++v) {
+            stubs.insert(stubs.end(), degrees[v], v);
+        }
+        shuffle_sequence(stubs.begin(), stubs.end(), gen);
+        edge_list_t edges(m);
+        for(std::size_t i = 0; i < m; ++i) {
+            edges[i] = {stubs[2 * i], stubs[2 * i + 1]};
+        }
+        // first copy of every pair is good and stays in present, loops and later copies are bad
+        detail::IndexSet present(m);
+        std::vector<std::size_t> bad;
+        std::vector<bool> is_bad(m, false);
+        for(std::size_t i = 0; i < m; ++i) {
+            auto const [a, b] = edges[i];
+            if(a == b || !present.insert(detail::index_of_pair(a, b))) {
+                bad.push_back(i);
+                is_bad[i] = true;
+            }
+        }
+        repairs = bad.size();
+        uint64_t attempts = 64 * m + 1024; //NOLINT(*-magic-numbers)
+        for(auto i : bad) {
+            auto const [a, b] = edges[i];
+            while(true) {
+                assume(attempts-- > 0);
+                // one word picks the edge and its orientation
+                auto const r = uni_dist<uint64_t>::gen(0, 2 * m - 1, gen);
+                auto const j = static_cast<std::size_t>(r / 2);
+                if(is_bad[j]) { continue; }
+                auto [c, d] = edges[j];
+                if(r % 2 != 0) { std::swap(c, d); }
+                if(a == c || b == d) { continue; }
+                auto const first = detail::index_of_pair(a, c);
+                auto const second = detail::index_of_pair(b, d);
+                if(first == second || present.contains(first) || present.contains(second)) { continue; }
+                present.erase(detail::index_of_pair(c, d));
+                present.insert(first);
+                present.insert(second);
+                edges[i] = {a, c};
+                edges[j] = {b, d};
+                is_bad[i] = false;
+                break;
+            }
+        }
+        return edges;
+    }
+
+public:
+    explicit ConfigurationModel(std::vector<uint> degrees) :
+      RandomGraphBase{static_cast<uint>(degrees.size())},
+      degrees{std::move(degrees)},
+      m{std::accumulate(this->degrees.begin(), this->degrees.end(), uint64_t{0}) / 2} {
+        assume(std::accumulate(this->degrees.begin(), this->degrees.end(), uint64_t{0}) % 2 == 0);
+        assume(std::all_of(this->degrees.begin(), this->degrees.end(), [this](uint d) { return d < n; }));
+    }
+
+    // repairs is set to the number of switches which were needed to make the graph (or its complement) simple
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen, uint64_t & repairs) const {
+        auto const pairs = detail::pairs_count(n);
+        if(2 * m <= pairs) { return pairStubs(degrees, m, gen, repairs); }
+        std::vector<uint> complement(n);
+        std::transform(degrees.begin(), degrees.end(), complement.begin(), [this](uint d) { return n - 1 - d; });
+        auto const missing = pairStubs(complement, pairs - m, gen, repairs);
+        detail::IndexSet absent(missing.size());
+        for(auto [a, b] : missing) {
+            absent.insert(detail::index_of_pair(a, b));
+        }
+        edge_list_t edges;
+        edges.reserve(m);
+        for(auto a = 1U; a < n; ++a) {
+            for(auto b = 0U; b < a; ++b) {
+                if(!absent.contains(detail::index_of_pair(a, b))) { edges.emplace_back(a, b); }
+            }
+        }
+        shuffle_sequence(edges.begin(), edges.end(), gen);
+        return edges;
+    }
+
+    [[nodiscard]] edge_list_t generateEdges(gen_type & gen) const {
+        uint64_t repairs{};
+        return generateEdges(gen, repairs);
+    }
+
+    // same edges as generateEdges, they are generated all at once, so O(n + m) memory
+    template<typename Fun>
+    void forEachEdge(gen_type & gen, Fun && fun) const {
+        for(auto [a, b] : generateEdges(gen)) {
+            fun(a, b);
+        }
+    }
+
+    using RandomGraphBase::generate;
+
+    [[nodiscard]] Graph generate(gen_type & gen, uint64_t & repairs) const {
+        return Graph(n, generateEdges(gen, repairs));
+    }
+};
+
+// uniformly random labelled d-regular graph is approximated by configuration model, n * d must be even
+class RandomRegular : public ConfigurationModel {
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    RandomRegular(uint n, uint d) :
+      ConfigurationModel(std::vector<uint>(n, d)) {
+        assume(d < n);
+    }
+};
+
+/* CRTP, assumes Derived has 'forEachEdge(fun)' method calling fun(a, b) for each edge of graph
+ * on n vertices before random relabelling and 'edgeCount()' method returning their number */
+template<typename Derived>
+class StaticGraphBase : public Generating<Graph> {
+protected:
+    uint n;
+
+    explicit StaticGraphBase(uint n) :
+      n{n} {}
+
+public:
+    [[nodiscard]] edge_list_t generateEdges() const {
+        auto const & derived = *static_cast<const Derived *>(this);
+        edge_list_t edges;
+        edges.reserve(derived.edgeCount());
+        derived.forEachEdge([&edges](uint a, uint b) { edges.emplace_back(a, b); });
+        return edges;
+    }
+
+    /* calls fun(a, b) for every edge with random labels, without storing edges: only permutation is kept.
+     * Labels are the same as of generateEdgeList(gen), but edges keep order and orientation of generateEdges(). */
+    template<typename Fun>
+    void streamEdges(gen_type & gen, Fun && fun) const {
+        auto const label = get_permutation(n, gen);
+        static_cast<const Derived *>(this)->forEachEdge([&label, &fun](uint a, uint b) { fun(label[a], label[b]); });
+    }
+
+    // edges of streamEdges(gen, ...) passed to fun(edge_list_t const &) in batches
+    template<typename Fun>
+    void streamBatches(gen_type & gen, Fun && fun, std::size_t batch = detail::EDGE_BATCH) const {
+        detail::stream_batches([this, &gen](auto && f) { streamEdges(gen, f); }, batch, fun);
+    }
+
+    [[nodiscard]] Graph generate() const {
+        return Graph(n, generateEdges());
+    }
+
+    [[nodiscard]] Graph generate(gen_type & gen) const override {
+        Graph G = generate();
+        G.permute(gen);
+        return G;
+    }
+
+    [[nodiscard]] CsrGraph generateCsr() const {
+        return CsrGraph(n, generateEdges());
+    }
+
+    // same graph as generate(gen) would give
+    [[nodiscard]] CsrGraph generateCsr(gen_type & gen) const {
+        CsrGraph G = generateCsr();
+        G.permute(gen);
+        return G;
+    }
+
+    // randomly relabelled with EdgeListGraph::permute, so it differs from generate(gen)
+    [[nodiscard]] EdgeListGraph generateEdgeList(gen_type & gen) const {
+        EdgeListGraph G{n, generateEdges()};
+        G.permute(gen);
+        return G;
+    }
+};
+
+class Path : public StaticGraphBase<Path> {
+public:
+    explicit Path(uint n) :
+      StaticGraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n - 1;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto w = 0U; w < n - 1; ++w) {
+            fun(w, w + 1);
+        }
+    }
+};
+
+class Clique : public StaticGraphBase<Clique> {
+public:
+    explicit Clique(uint n) :
+      StaticGraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return static_cast<std::size_t>(n) * (n - 1) / 2;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(uint i = 0; i < n; i++) {
+            for(uint j = i + 1; j < n; j++) {
+                fun(i, j);
+            }
+        }
+    }
+};
+
+class Cycle : public StaticGraphBase<Cycle> {
+public:
+    explicit Cycle(uint n) :
+      StaticGraphBase{n} {
+        assume(n >= 3U);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto i = 0U; i < n - 1; i++) {
+            fun(i, i + 1);
+        }
+        fun(n - 1, 0U);
+    }
+};
+
+class Star : public StaticGraphBase<Star> {
+public:
+    explicit Star(uint n) :
+      StaticGraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n - 1;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto i = 1U; i < n; i++) {
+            fun(0U, i);
+        }
+    }
+};
+
+/* Path 0, ..., handle - 1 with all other vertices attached to its last vertex. */
+class Broom : public StaticGraphBase<Broom> {
+    uint handle;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Broom(uint n, uint handle) :
+      StaticGraphBase{n}, handle{handle} {
+        assume(1U <= handle && handle <= n);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return n - 1;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto i = 1U; i < handle; ++i) {
+            fun(i - 1, i);
+        }
+        for(auto i = handle; i < n; ++i) {
+            fun(handle - 1, i);
+        }
+    }
+};
+
+/* Grid rows x cols, vertex (r, c) is r * cols + c, neighbours are computed arithmetically. */
+class Grid : public StaticGraphBase<Grid> {
+    uint rows;
+    uint cols;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    Grid(uint rows, uint cols) :
+      StaticGraphBase{rows * cols}, rows{rows}, cols{cols} {
+        assume(rows >= 1U && cols >= 1U);
+    }
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return static_cast<std::size_t>(rows) * (cols - 1) + static_cast<std::size_t>(rows - 1) * cols;
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        for(auto r = 0U; r < rows; ++r) {
+            for(auto c = 0U; c < cols; ++c) {
+                auto const w = r * cols + c;
+                if(c + 1 < cols) { fun(w, w + 1); }
+                if(r + 1 < rows) { fun(w, w + cols); }
+            }
+        }
+    }
+};
+
+/* Grid rows x cols with diagonal (r, c) - (r + 1, c + 1) in every square: planar graph whose inner
+ * faces are all triangles. */
+class TriangulatedGrid : public StaticGraphBase<TriangulatedGrid> {
+    Grid grid;
+    uint rows;
+    uint cols;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    TriangulatedGrid(uint rows, uint cols) :
+      StaticGraphBase{rows * cols}, grid{rows, cols}, rows{rows}, cols{cols} {}
+
+    [[nodiscard]] std::size_t edgeCount() const {
+        return grid.edgeCount() + static_cast<std::size_t>(rows - 1) * (cols - 1);
+    }
+
+    template<typename Fun>
+    void forEachEdge(Fun && fun) const {
+        grid.forEachEdge(fun);
+        for(auto r = 0U; r + 1 < rows; ++r) {
+            for(auto c = 0U; c + 1 < cols; ++c) {
+                fun(r * cols + c, (r + 1) * cols + c + 1);
+            }
+        }
+    }
+};
+
+/* ==================== digraph.hpp ====================*/
+
+/* Directed graph in compressed sparse row form: out-neighbours of w are
+ * neighbours[offsets[w]], ..., neighbours[offsets[w + 1] - 1], in order in which arcs were given.
+ * Arc (a, b) goes from a to b and is stored once, loops and multi-arcs are kept. */
+class Digraph {
+    std::vector<std::size_t> offsets;
+    std::vector<uint> neighbours{};
+
+public:
+    using NeighbourRange = CsrGraph::NeighbourRange;
+
+    Digraph() :
+      offsets(1, 0) {}
+
+    // counting sort of arcs by source
+    template<typename List>
+    Digraph(std::size_t n, List const & arcs) :
+      offsets(n + 2, 0) {
+        for(auto [a, b] : arcs) {
+            ++offsets[a + 2];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        neighbours.resize(offsets.back());
+        // offsets[w + 1] is the first free position of w, after the pass it is the end of w
+        for(auto [a, b] : arcs) {
+            neighbours[offsets[a + 1]++] = b;
+        }
+        offsets.pop_back();
+    }
+
+    Digraph(std::size_t n, std::initializer_list<std::pair<uint, uint>> const & arcs) :
+      Digraph(n, std::vector<std::pair<uint, uint>>(arcs)) {}
+
+    [[nodiscard]] NeighbourRange operator[](uint i) const noexcept {
+        return {neighbours.data() + offsets[i], neighbours.data() + offsets[i + 1]};
+    }
+
+    // random labels drawn like in Graph::permute, then out-neighbours of each vertex are shuffled
+    void permute(gen_type & gen, bool shuffle_neighbours = true) {
+        auto const n = size();
+        auto const per = get_permutation(n, gen);
+        std::vector<std::size_t> new_offsets(n + 1, 0);
+        for(uint w = 0; w < n; ++w) {
+            new_offsets[per[w] + 1] = offsets[w + 1] - offsets[w];
+        }
+        std::partial_sum(new_offsets.begin(), new_offsets.end(), new_offsets.begin());
+        std::vector<uint> new_neighbours(neighbours.size());
+        for(uint w = 0; w < n; ++w) {
+            auto const V = (*this)[w];
+            std::transform(V.begin(), V.end(), new_neighbours.begin() + new_offsets[per[w]], [&per](uint v) { return per[v]; });
+        }
+        for(uint w = 0; w < n && shuffle_neighbours; ++w) {
+            shuffle_sequence(new_neighbours.begin() + new_offsets[w], new_neighbours.begin() + new_offsets[w + 1], gen);
+        }
+        offsets = std::move(new_offsets);
+        neighbours = std::move(new_neighbours);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return offsets.size() - 1;
+    }
+
+    [[nodiscard]] std::size_t arcCount() const noexcept {
+        return neighbours.size();
+    }
+
+    // arcs ordered by source
+    [[nodiscard]] edge_list_t getEdges() const {
+        edge_list_t res;
+        res.reserve(arcCount());
+        auto const n = size();
+        for(auto a = 0U; a < n; a++) {
+            for(auto b : (*this)[a]) {
+                res.emplace_back(a, b);
+            }
+        }
+        return res;
+    }
+};
+
+/* CRTP, assumes Derived has 'generateArcs(gen)' method returning arcs of random digraph on n vertices */
+template<typename Derived>
+class RandomDigraphBase : public Generating<Digraph> {
+protected:
+    uint n;
+
+    explicit RandomDigraphBase(uint n) :
+      n{n} {}
+
+public:
+    [[nodiscard]] Digraph generate(gen_type & gen) const override {
+        return Digraph(n, static_cast<const Derived *>(this)->generateArcs(gen));
+    }
+};
+
+/* Acyclic digraph with exactly m distinct arcs, chosen uniformly from arcs going forward in hidden
+ * topological order, expected O(n + m) time. With shuffled = false the order is 0, 1, ..., n - 1,
+ * i.e. every arc goes from smaller to larger label. */
+class RandomDag : public RandomDigraphBase<RandomDag> {
+    uint64_t m;
+    bool shuffled;
+
+public:
+    RandomDag(uint n, uint64_t m, bool shuffled = true) :
+      RandomDigraphBase{n}, m{m}, shuffled{shuffled} {
+        assume(n >= 1U);
+        assume(m <= detail::pairs_count(n));
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        std::vector<uint> order(n);
+        std::iota(order.begin(), order.end(), 0U);
+        if(shuffled) { shuffle_sequence(order.begin(), order.end(), gen); }
+        edge_list_t arcs;
+        arcs.reserve(m);
+        detail::sample_indices(detail::pairs_count(n), m, gen, [&, cursor = detail::pair_cursor{}](uint64_t k) mutable {
+            auto const [later, earlier] = cursor(k);
+            arcs.emplace_back(order[earlier], order[later]);
+        });
+        // otherwise out-neighbours would come in topological order
+        if(shuffled) { shuffle_sequence(arcs.begin(), arcs.end(), gen); }
+        return arcs;
+    }
+};
+
+/* Every vertex v has exactly one outgoing arc, to f(v) chosen uniformly from [0, n) (loops allowed). */
+class FunctionalGraph : public RandomDigraphBase<FunctionalGraph> {
+public:
+    explicit FunctionalGraph(uint n) :
+      RandomDigraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        std::vector<uint> f(n);
+        uni_dist<uint>(0, n - 1).fill(f.data(), f.size(), gen);
+        edge_list_t arcs(n);
+        for(auto v = 0U; v < n; ++v) {
+            arcs[v] = {v, f[v]};
+        }
+        return arcs;
+    }
+};
+
+/* Every pair of vertices joined by exactly one arc of random direction, one random bit per pair. */
+class Tournament : public RandomDigraphBase<Tournament> {
+public:
+    explicit Tournament(uint n) :
+      RandomDigraphBase{n} {
+        assume(n >= 1U);
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        constexpr unsigned BITS = 64;
+        edge_list_t arcs;
+        arcs.reserve(detail::pairs_count(n));
+        uint64_t word{};
+        unsigned used = BITS;
+        for(auto a = 0U; a < n; ++a) {
+            for(auto b = a + 1; b < n; ++b) {
+                if(used == BITS) {
+                    word = gen();
+                    used = 0;
+                }
+                if((word >> used++ & 1U) != 0) {
+                    arcs.emplace_back(a, b);
+                } else {
+                    arcs.emplace_back(b, a);
+                }
+            }
+        }
+        return arcs;
+    }
+};
+
+/* Strongly connected digraph without loops and multi-arcs with exactly m arcs: Hamiltonian cycle
+ * and m - n other arcs chosen uniformly from the remaining ones, by rank, so without rejection,
+ * expected O(n + m) time. Labels and order of out-neighbours are random. */
+class StronglyConnected : public RandomDigraphBase<StronglyConnected> {
+    uint64_t m;
+
+public:
+    StronglyConnected(uint n, uint64_t m) :
+      RandomDigraphBase{n}, m{m} {
+        assume(n >= 1U);
+        assume(n == 1U ? m == 0 : n <= m && m <= 2 * detail::pairs_count(n));
+    }
+
+    [[nodiscard]] edge_list_t generateArcs(gen_type & gen) const {
+        if(n == 1) { return {}; }
+        auto const label = get_permutation(static_cast<int>(n), gen);
+        edge_list_t arcs;
+        arcs.reserve(m);
+        for(auto i = 0U; i < n; ++i) {
+            arcs.emplace_back(label[i], label[(i + 1) % n]);
+        }
+        // arc (a, b), a != b, has index a(n - 1) + b - [b > a]; cycle arc (i, i + 1) has index i * n
+        // and (n - 1, 0) has index (n - 1)^2, so r-th non-cycle arc is k = r + j with j = number of
+        // cycle arcs smaller than k
+        uint64_t j = 0;
+        auto const cycle_index = [this](uint64_t i) { return i + 1 < n ? i * n : static_cast<uint64_t>(n - 1) * (n - 1); };
+        detail::sample_indices(2 * detail::pairs_count(n) - n, m - n, gen, [&](uint64_t r) {
+            while(j < n && cycle_index(j) <= r + j) {
+                ++j;
+            }
+            auto const k = r + j;
+            auto const a = static_cast<uint>(k / (n - 1));
+            auto b = static_cast<uint>(k % (n - 1));
+            if(b >= a) { ++b; }
+            arcs.emplace_back(label[a], label[b]);
+        });
+        shuffle_sequence(arcs.begin(), arcs.end(), gen);
+        return arcs;
+    }
+};
+
+/* ==================== writer.hpp ====================*/
+
+/* Buffered output of integers, characters and strings without locale and formatting flags.
+ * Numbers are formatted with std::to_chars straight into owned buffer, which is handed to
+ * target streambuf in one sputn call when full, so file streams write it with a single syscall.
+ * Buffered data is written on flush(), set() and destruction. */
+class Writer {
+public:
+    static constexpr std::size_t BUFFER_SIZE = std::size_t{1} << 16U;
+
+private:
+    static constexpr std::size_t MAX_INTEGER_WIDTH = 24; // sign and 20 digits of 64-bit integer
+
+    std::streambuf * target{nullptr};
+    // not value-initialised, so short-lived writers do not zero 64 KiB each
+    std::unique_ptr<char[]> buffer{new char[BUFFER_SIZE]}; //NOLINT(*-avoid-c-arrays)
+    std::size_t used{0};
+
+    void reserve(std::size_t n) {
+        if(used + n > BUFFER_SIZE) { flush(); }
+    }
+
+    Writer & put(char c) {
+        reserve(1);
+        buffer[used++] = c;
+        return *this;
+    }
+
+public:
+    Writer() = default;
+    explicit Writer(std::ostream & stream) :
+      target{stream.rdbuf()} {}
+    Writer(Writer const &) = delete;
+    Writer(Writer &&) = delete;
+    Writer & operator=(Writer const &) = delete;
+    Writer & operator=(Writer &&) = delete;
+    ~Writer() {
+        flush();
+    }
+
+    // writes buffered data to old stream first
+    void set(std::ostream & stream) {
+        flush();
+        target = stream.rdbuf();
+    }
+
+    void flush() {
+        if(used != 0 && target != nullptr) {
+            target->sputn(buffer.get(), static_cast<std::streamsize>(used));
+        }
+        used = 0;
+    }
+
+    Writer & operator<<(std::string_view str) {
+        if(str.size() > BUFFER_SIZE) {
+            flush();
+            if(target != nullptr) {
+                target->sputn(str.data(), static_cast<std::streamsize>(str.size()));
+            }
+            return *this;
+        }
+        reserve(str.size());
+        std::memcpy(buffer.get() + used, str.data(), str.size());
+        used += str.size();
+        return *this;
+    }
+
+    Writer & operator<<(char const * str) {
+        return *this << std::string_view{str};
+    }
+
+    Writer & operator<<(std::string const & str) {
+        return *this << std::string_view{str};
+    }
+
+    // same text as std::ostream gives with default flags: bool as 0/1, char types as characters;
+    // template also for char, so that floating-point values never convert to it
+    template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    Writer & operator<<(T value) {
+        if constexpr(std::is_same_v<T, bool>) {
+            return put(static_cast<char>('0' + static_cast<int>(value)));
+        } else if constexpr(sizeof(T) == 1) {
+            return put(static_cast<char>(value));
+        } else {
+            reserve(MAX_INTEGER_WIDTH);
+            auto * const begin = buffer.get() + used;
+            used += static_cast<std::size_t>(std::to_chars(begin, begin + MAX_INTEGER_WIDTH, value).ptr - begin);
+            return *this;
+        }
+    }
+};
+
+namespace detail {
+
+template<typename T, typename = void>
+struct is_writable : std::false_type {}; //NOLINT(readability-identifier-naming)
+
+template<typename T>
+struct is_writable<T, std::void_t<decltype(std::declval<Writer &>() << std::declval<T const &>())>> : std::true_type {};
+
+template<typename T, typename = void>
+struct is_ostreamable : std::false_type {}; //NOLINT(readability-identifier-naming)
+
+template<typename T>
+struct is_ostreamable<T, std::void_t<decltype(std::declval<std::ostream &>() << std::declval<T const &>())>> : std::true_type {};
+
+// stream formats integers and strings exactly like Writer: default flags and no field width
+inline bool has_default_format(std::ios_base const & stream) {
+    return stream.flags() == (std::ios_base::skipws | std::ios_base::dec) && stream.width() == 0;
+}
+
+// floating-point values are left to std::ostream, which formats them with its precision
+template<typename T>
+inline constexpr bool is_writable_v = is_writable<T>::value && !std::is_floating_point_v<T>; //NOLINT(readability-identifier-naming)
+
+} /* namespace detail */
+
+/* ==================== sequence.hpp ====================*/
+
+template<typename T>
+class Sequence : public std::vector<T> {
+    template<typename Gen, std::enable_if_t<std::is_invocable_v<Gen>, int> = 0>
+    static void seqGenerate(Sequence & s, Gen && gen) {
+        std::generate(s.begin(), s.end(), gen);
+    }
+
+    template<typename Gen, std::enable_if_t<std::is_invocable_v<Gen, unsigned>, int> = 0>
+    static void seqGenerate(Sequence & s, Gen && gen) {
+        std::generate(s.begin(), s.end(), [&gen, cnt = 0U]() mutable { return std::invoke(gen, cnt++); });
+    }
+
+public:
+    using std::vector<T>::vector;
+
+    template<typename Gen, typename = std::enable_if_t<std::is_invocable_v<Gen> || std::is_invocable_v<Gen, unsigned>>>
+    Sequence(std::size_t size, Gen && gen) :
+      std::vector<T>(size) {
+        seqGenerate(*this, std::forward<Gen>(gen));
+    }
+
+    // bulk generation of numbers from dist, faster than generating one by one
+    template<typename Gen>
+    Sequence(std::size_t size, uni_dist<T> const & dist, Gen && gen) :
+      std::vector<T>(size) {
+        dist.fill(this->data(), size, std::forward<Gen>(gen));
+    }
+
+    Sequence operator+(Sequence const & x) const {
+        Sequence res(this->size() + x.size());
+        auto const it = std::copy(this->begin(), this->end(), res.begin());
+        std::copy(x.begin(), x.end(), it);
+        return res;
+    }
+
+    Sequence & operator+=(Sequence const & x) {
+        auto const old_size = this->size();
+        this->resize(old_size + x.size());
+        std::copy(x.begin(), x.end(), this->begin() + old_size);
+        return *this;
+    }
+
+    template<typename U = T, std::enable_if_t<detail::is_writable_v<U>, int> = 0>
+    friend Writer & operator<<(Writer & s, Sequence const & x) {
+        auto it = x.begin();
+        auto const end = x.end();
+        if(it == end) { return s; }
+        s << *it++;
+        while(it != end) {
+            s << ' ' << *it++;
+        }
+        return s;
+    }
+
+    // integers are formatted with Writer when stream has default format, otherwise by stream
+    friend std::ostream & operator<<(std::ostream & s, Sequence const & x) {
+        if constexpr(detail::is_writable_v<T>) {
+            if(detail::has_default_format(s)) {
+                Writer writer{s};
+                writer << x;
+                return s;
+            }
+        }
+        auto it = x.begin();
+        auto const end = x.end();
+        if(it == end) { return s; }
+        s << *it++;
+        while(it != end) {
+            s << ' ' << *it++;
+        }
+        return s;
+    }
+};
+
+/* ==================== weighted.hpp ====================*/
+
+using weight_t = int64_t;
+
+/* Edge list with weights in separate array: weight of edges[i] is weights[i]. Arrays are kept apart,
+ * so generators fill weights in bulk and structure can be generated and relabelled independently,
+ * e.g. WeightedGraph G(Gnm(n, m).generateEdgeList(gen)); uniformWeights(G, 1, 1000, gen); */
+class WeightedGraph {
+    std::size_t n;
+    edge_list_t edges{};
+    std::vector<weight_t> weights{};
+
+public:
+    WeightedGraph() :
+      WeightedGraph(0) {}
+    explicit WeightedGraph(std::size_t n) :
+      n{n} {}
+    // all weights are 0
+    WeightedGraph(std::size_t n, edge_list_t edges) :
+      n{n}, edges{std::move(edges)}, weights(this->edges.size(), 0) {}
+    WeightedGraph(std::size_t n, edge_list_t edges, std::vector<weight_t> weights) :
+      n{n}, edges{std::move(edges)}, weights{std::move(weights)} {
+        assume(this->edges.size() == this->weights.size());
+    }
+    explicit WeightedGraph(EdgeListGraph const & G) :
+      WeightedGraph(G.size(), G.getEdges()) {}
+    explicit WeightedGraph(Graph const & G) :
+      WeightedGraph(G.size(), G.getEdges()) {}
+
+    void addEdge(uint a, uint b, weight_t w) {
+        edges.emplace_back(a, b);
+        weights.push_back(w);
+    }
+
+    // vertex v becomes label[v]
+    void relabel(std::vector<uint> const & label) {
+        for(auto & [a, b] : edges) {
+            a = label[a];
+            b = label[b];
+        }
+    }
+
+    // random labels, random order of edges (weights move with them) and random orientation of each edge
+    void permute(gen_type & gen) {
+        relabel(get_permutation(static_cast<int>(n), gen));
+        auto order = get_permutation(static_cast<int>(edges.size()), gen);
+        for(std::size_t i = 0; i < order.size(); ++i) {
+            while(order[i] != i) {
+                auto const target = order[i];
+                std::swap(edges[i], edges[target]);
+                std::swap(weights[i], weights[target]);
+                std::swap(order[i], order[target]);
+            }
+        }
+        constexpr std::size_t BITS = 64;
+        uint64_t word{};
+        for(std::size_t i = 0; i < edges.size(); ++i) {
+            if(i % BITS == 0) { word = gen(); }
+            if((word >> (i % BITS) & 1U) != 0) {
+                std::swap(edges[i].first, edges[i].second);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return n;
+    }
+
+    [[nodiscard]] edge_list_t const & getEdges() const noexcept {
+        return edges;
+    }
+
+    [[nodiscard]] std::vector<weight_t> const & getWeights() const noexcept {
+        return weights;
+    }
+
+    [[nodiscard]] std::vector<weight_t> & getWeights() noexcept {
+        return weights;
+    }
+
+    // structure without weights
+    [[nodiscard]] Graph toGraph() const {
+        return Graph(n, edges);
+    }
+
+    // structure without weights
+    [[nodiscard]] CsrGraph toCsr() const {
+        return CsrGraph(n, edges);
+    }
+};
+
+// every weight independently uniform from [lo:hi]
+inline void uniformWeights(WeightedGraph & G, weight_t lo, weight_t hi, gen_type & gen) {
+    auto & weights = G.getWeights();
+    uni_dist<weight_t>::fill(lo, hi, weights.data(), weights.size(), gen);
+}
+
+// pairwise distinct weights from [lo:hi], uniformly chosen set in random order, expected O(m)
+inline void distinctWeights(WeightedGraph & G, weight_t lo, weight_t hi, gen_type & gen) {
+    auto & weights = G.getWeights();
+    auto const range = static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1;
+    assume(lo <= hi);
+    if(range == 0) {
+        // whole weight_t, 2^64 values: raw draws are taken in order, rare repeats are redrawn;
+        // IndexSet can not hold ~0, which is tracked apart
+        detail::IndexSet drawn(weights.size());
+        bool drawn_max = false;
+        auto const fresh = [&drawn, &drawn_max](uint64_t k) {
+            return k == ~uint64_t{0} ? !std::exchange(drawn_max, true) : drawn.insert(k);
+        };
+        for(auto & weight : weights) {
+            auto k = gen();
+            while(!fresh(k)) {
+                k = gen();
+            }
+            weight = static_cast<weight_t>(k);
+        }
+        return;
+    }
+    assume(weights.size() <= range);
+    auto it = weights.begin();
+    detail::sample_indices(range, weights.size(), gen, [&it, lo](uint64_t k) {
+        *it++ = static_cast<weight_t>(static_cast<uint64_t>(lo) + k);
+    });
+    shuffle_sequence(weights.begin(), weights.end(), gen);
+}
+
+// weights from [lo:2lo], so sum of any two is at least any third one: triangle inequality holds
+// and every edge is a shortest path between its endpoints
+inline void metricWeights(WeightedGraph & G, weight_t lo, gen_type & gen) {
+    assume(lo >= 1);
+    uniformWeights(G, lo, 2 * lo, gen);
+}
+
+/* Adversarial weights for Dijkstra from vertex 0 which does not skip outdated heap entries:
+ * edge (u, u + 1) gets 1, other edges (u, v), u < v, get 2(n - u). With path 0, 1, ..., n - 1 in graph
+ * dist(u) = u and vertices are popped in order of labels, while every popped u improves distance
+ * of all its neighbours v > u once more, so each vertex is pushed about deg(v) times.
+ * Apply it before random relabelling. */
+inline void antiDijkstraWeights(WeightedGraph & G) {
+    auto const n = static_cast<weight_t>(G.size());
+    auto const & edges = G.getEdges();
+    auto & weights = G.getWeights();
+    for(std::size_t i = 0; i < edges.size(); ++i) {
+        auto const [a, b] = edges[i];
+        auto const u = std::min(a, b);
+        auto const v = std::max(a, b);
+        weights[i] = v == u + 1 ? 1 : 2 * (n - static_cast<weight_t>(u));
+    }
+}
+
+/* ==================== output.hpp ====================*/
+
+class Output : public std::ostream {
+public:
+    explicit Output(std::ostream && stream) :
+      std::ostream(std::move(stream)) {}
+    explicit Output(std::ostream & stream) {
+        set(stream);
+    }
+    Output() = default;
+    Output(Output const &) = delete;
+    Output(Output &&) = delete;
+    Output & operator=(Output const &) = delete;
+    Output & operator=(Output &&) = delete;
+    ~Output() override = default;
+
+    void set(std::ostream & stream) {
+        rdbuf(stream.rdbuf());
+    }
+};
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdges(Writer & s, GraphT const & g, int shift = 0) {
+    detail::for_each_edge(g, [&s, shift](uint a, uint b) {
+        s << a + shift << ' ' << b + shift << '\n';
+    });
+}
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdges(std::ostream & s, GraphT const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+namespace detail {
+
+constexpr uint NO_PARENT = ~0U;
+
+// parent of every vertex in tree rooted at root, NO_PARENT for root;
+// DFS with explicit stack, so depth of tree is not limited by call stack
+// g has to be connected, vertex unreachable from root fails like assume
+template<typename GraphT>
+std::vector<uint> tree_parents(GraphT const & g, uint root) {
+    std::vector<uint> parent(g.size(), NO_PARENT);
+    std::vector<uint> stack{root};
+    std::size_t reached = 1;
+    while(!stack.empty()) {
+        auto const w = stack.back();
+        stack.pop_back();
+        for(auto v : g[w]) {
+            if(v != root && parent[v] == NO_PARENT) {
+                parent[v] = w;
+                stack.push_back(v);
+                ++reached;
+            }
+        }
+    }
+    assume(reached == g.size());
+    return parent;
+}
+
+} /* namespace detail */
+
+// parent of every vertex except root, one per line, in order of vertices; g has to be connected
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdgesAsTree(Writer & s, GraphT const & g, int shift = 0, uint root = 0) {
+    auto const parent = detail::tree_parents(g, root);
+    for(uint i = 0; i < g.size(); i++) {
+        if(i != root) {
+            s << static_cast<int64_t>(parent[i]) + shift << '\n';
+        }
+    }
+}
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printEdgesAsTree(std::ostream & s, GraphT const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printEdgesAsTree(writer, g, shift, root);
+}
+
+// parents of all vertices in one line, root gets shift - 1 (-1 for 0-based, 0 for 1-based labels);
+// g has to be connected
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printParents(Writer & s, GraphT const & g, int shift = 0, uint root = 0) {
+    auto const parent = detail::tree_parents(g, root);
+    for(uint i = 0; i < g.size(); i++) {
+        if(i != 0) { s << ' '; }
+        if(i == root) {
+            s << shift - 1;
+        } else {
+            s << static_cast<int64_t>(parent[i]) + shift;
+        }
+    }
+    s << '\n';
+}
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+void printParents(std::ostream & s, GraphT const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printParents(writer, g, shift, root);
+}
+
+// edges in stored order and orientation
+void printEdges(Writer & s, EdgeListGraph const & g, int shift = 0) {
+    for(auto [a, b] : g.getEdges()) {
+        s << a + shift << ' ' << b + shift << '\n';
+    }
+}
+
+void printEdges(std::ostream & s, EdgeListGraph const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+// needs neighbours, so graph is converted to CsrGraph first
+void printEdgesAsTree(Writer & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    printEdgesAsTree(s, g.toCsr(), shift, root);
+}
+
+void printEdgesAsTree(std::ostream & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printEdgesAsTree(writer, g, shift, root);
+}
+
+// needs neighbours, so graph is converted to CsrGraph first
+void printParents(Writer & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    printParents(s, g.toCsr(), shift, root);
+}
+
+void printParents(std::ostream & s, EdgeListGraph const & g, int shift = 0, uint root = 0) {
+    Writer writer{s};
+    printParents(writer, g, shift, root);
+}
+
+// arc a -> b as 'a b' line, arcs ordered by source
+void printEdges(Writer & s, Digraph const & g, int shift = 0) {
+    for(auto a = 0U; a < g.size(); a++) {
+        for(auto b : g[a]) {
+            s << a + shift << ' ' << b + shift << '\n';
+        }
+    }
+}
+
+void printEdges(std::ostream & s, Digraph const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+// 'a b w' lines, edges in stored order and orientation
+void printEdges(Writer & s, WeightedGraph const & g, int shift = 0) {
+    auto const & edges = g.getEdges();
+    auto const & weights = g.getWeights();
+    for(std::size_t i = 0; i < edges.size(); ++i) {
+        s << edges[i].first + shift << ' ' << edges[i].second + shift << ' ' << weights[i] << '\n';
+    }
+}
+
+void printEdges(std::ostream & s, WeightedGraph const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+template<typename GraphT>
+void printEdges(Writer & s, RelabelledGraph<GraphT> const & g, int shift = 0) {
+    auto const & label = g.label();
+    detail::for_each_edge(g.graph(), [&s, &label, shift](uint a, uint b) {
+        s << label[a] + shift << ' ' << label[b] + shift << '\n';
+    });
+}
+
+template<typename GraphT>
+void printEdges(std::ostream & s, RelabelledGraph<GraphT> const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+/* Edges of graph schema generated with gen straight into output, e.g. t << edgeStream(Path(n), t.generator()).
+ * Graph is never stored: schema.streamEdges passes edges to Writer, whose buffer is flushed in batches.
+ * Schema has to outlive the stream; printing it twice gives two different graphs. */
+template<typename SchemaT>
+class EdgeStream {
+    SchemaT const & schema;
+    gen_type & gen;
+
+public:
+    EdgeStream(SchemaT const & schema, gen_type & gen) :
+      schema{schema}, gen{gen} {}
+
+    template<typename Fun>
+    void operator()(Fun && fun) const {
+        schema.streamEdges(gen, std::forward<Fun>(fun));
+    }
+};
+
+template<typename SchemaT>
+EdgeStream<SchemaT> edgeStream(SchemaT const & schema, gen_type & gen) {
+    return {schema, gen};
+}
+
+template<typename SchemaT>
+void printEdges(Writer & s, EdgeStream<SchemaT> const & g, int shift = 0) {
+    g([&s, shift](uint a, uint b) {
+        s << a + shift << ' ' << b + shift << '\n';
+    });
+}
+
+template<typename SchemaT>
+void printEdges(std::ostream & s, EdgeStream<SchemaT> const & g, int shift = 0) {
+    Writer writer{s};
+    printEdges(writer, g, shift);
+}
+
+// edges, one per line
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+Writer & operator<<(Writer & s, GraphT const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+Writer & operator<<(Writer & s, EdgeListGraph const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+Writer & operator<<(Writer & s, Digraph const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+Writer & operator<<(Writer & s, WeightedGraph const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+template<typename GraphT>
+Writer & operator<<(Writer & s, RelabelledGraph<GraphT> const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+template<typename SchemaT>
+Writer & operator<<(Writer & s, EdgeStream<SchemaT> const & g) {
+    printEdges(s, g);
+    return s;
+}
+
+namespace detail {
+
+// integers, strings, sequences and graphs are formatted by writer, anything else by stream;
+// after manipulators like std::setw or std::hex values which stream can print go to stream, so they
+// are formatted as before, graphs are always printed by writer in decimal
+// writer stays buffered between calls and is flushed only before stream prints something,
+// so output keeps its order; owner has to flush writer before stream is switched or closed
+template<typename T>
+void print(Writer & writer, std::ostream & stream, T const & out) {
+    if constexpr(is_writable_v<T>) {
+        if constexpr(is_ostreamable<T>::value) {
+            if(!has_default_format(stream)) {
+                writer.flush();
+                stream << out;
+                return;
+            }
+        }
+        writer << out;
+    } else {
+        writer.flush();
+        stream << out;
+    }
+}
+
+} /* namespace detail */
+
+/* ==================== assumptions.hpp ====================*/
+
+template<typename TestcaseT>
+class AssumptionManager {
+public:
+    // using assumption_t = bool (*)(TestcaseT const &);
+    using assumption_t = std::function<bool(TestcaseT const &)>;
+
+private:
+    static bool empty(TestcaseT const & /*unused*/) {
+        return true;
+    }
+    assumption_t global = empty;
+    assumption_t suite = empty;
+    assumption_t test = empty;
+
+public:
+    template<typename AssT>
+    void setGlobal(AssT && fun) {
+        global = std::forward<AssT>(fun);
+    }
+    template<typename AssT>
+    void setSuite(AssT && fun) {
+        suite = std::forward<AssT>(fun);
+    }
+    template<typename AssT>
+    void setTest(AssT && fun) {
+        test = std::forward<AssT>(fun);
+    }
+    void resetGlobal() {
+        global = empty;
+    }
+    void resetSuite() {
+        suite = empty;
+    }
+    void resetTest() {
+        test = empty;
+    }
+    bool check(TestcaseT const & testcase) {
+        return test(testcase) && suite(testcase) && global(testcase);
+    }
+};
+
+template<typename Fun1T, typename Fun2T>
+auto operator&&(Fun1T && fun1, Fun2T && fun2) {
+    return [f1 = std::forward<Fun1T>(fun1), f2 = std::forward<Fun2T>(fun2)](auto const & testcase) mutable {
+        return f1(testcase) && f2(testcase);
+    };
+}
+
+template<typename Fun1T, typename Fun2T>
+auto operator||(Fun1T && fun1, Fun2T && fun2) {
+    return [f1 = std::forward<Fun1T>(fun1), f2 = std::forward<Fun2T>(fun2)](auto const & testcase) mutable {
+        return f1(testcase) || f2(testcase);
+    };
+}
+
+/* ==================== testing.hpp ====================*/
+
+// test registered with Testing::addTest, passed to its body when it is generated
+template<typename TestcaseT, typename AssumptionsT>
+class DeferredTest : public RngUtilities<DeferredTest<TestcaseT, AssumptionsT>> {
+    std::ostream & output;
+    Writer writer;
+    gen_type & gen;
+    AssumptionsT & assumptions;
+    std::string const & filename;
+    bool assumptions_held{true};
+
+public:
+    DeferredTest(std::ostream & output, gen_type & gen, AssumptionsT & assumptions, std::string const & filename) :
+      output{output}, writer{output}, gen{gen}, assumptions{assumptions}, filename{filename} {}
+
+    GeneratorWrapper<gen_type> generator() {
+        return GeneratorWrapper<gen_type>{gen};
+    }
+
+    [[nodiscard]] std::string const & getFilename() const {
+        return filename;
+    }
+
+    // false if some testcase failed assumptions; it is reported by runTests after all tests are generated
+    [[nodiscard]] bool assumptionsHeld() const {
+        return assumptions_held;
+    }
+
+    template<typename T>
+    auto generateFromSchema(Generating<T> const & schema) {
+        return schema.generate(gen);
+    }
+
+    // formats like Testing::operator<<, but failed assumption does not stop the program here,
+    // as other tests may still be generated on other threads
+    template<typename T>
+    DeferredTest & operator<<(T const & out) {
+        if constexpr(std::is_same_v<T, TestcaseT>) {
+            if(!assumptions.check(out)) {
+                assumptions_held = false;
+            }
+        }
+        if constexpr(is_generating<T>::value) {
+            detail::print(writer, output, generateFromSchema(out));
+        } else {
+            detail::print(writer, output, out);
+        }
+        return *this;
+    }
+};
+
+template<typename TestcaseManagerT, typename TestcaseT = std::false_type, template<typename> typename AssumptionsManagerT = AssumptionManager>
+class Testing : private TestcaseManagerT, public RngUtilities<Testing<TestcaseManagerT, TestcaseT, AssumptionsManagerT>> {
+    TestcaseT updateTestcase() {
+        output.set(this->stream());
+        writer.set(this->stream());
+        return TestcaseT{};
+    }
+
+    struct deferred_task {
+        std::string filename;
+        std::function<bool()> run; // false if assumptions failed
+    };
+
+    Output output;
+    Writer writer;
+    AssumptionsManagerT<TestcaseT> assumptions;
+    std::vector<deferred_task> deferred;
+
+public:
+    using TestcaseManagerT::TestcaseManagerT;
+
+    Testing(const Testing &) = delete;
+    Testing(Testing &&) = delete;
+    Testing & operator=(const Testing &) = delete;
+    Testing & operator=(Testing &&) = delete;
+    ~Testing() = default;
+
+    GeneratorWrapper<gen_type> generator() {
+        return GeneratorWrapper<gen_type>{TestcaseManagerT::generator()};
+    }
+
+    void skipTest() {
+        writer.flush();
+        TestcaseManagerT::skipTest();
+        assumptions.resetTest();
+    }
+
+    void nextSuite() {
+        writer.flush();
+        TestcaseManagerT::nextSuite();
+        assumptions.resetSuite();
+        assumptions.resetTest();
+    }
+
+    TestcaseT getTest() {
+        writer.flush();
+        TestcaseManagerT::nextTest();
+        assumptions.resetTest();
+        return updateTestcase();
+    }
+
+    void nextTest() {
+        writer.flush();
+        TestcaseManagerT::nextTest();
+        assumptions.resetTest();
+        updateTestcase();
+    }
+
+    // setTest(test_nr, suite), e.g. zad2c = (3, 2), 4ocen = (4, 0)
+    // resets suite and test assumptions!
+    template<typename T, typename U>
+    TestcaseT setTest(T test_nr, U suite) {
+        writer.flush();
+        TestcaseManagerT::setTest(test_nr, suite);
+        assumptions.resetSuite();
+        assumptions.resetTest();
+        return updateTestcase();
+    }
+
+    /* Registers next test to be generated by runTests. Its generator and assumptions are fixed now,
+     * so output does not depend on number of threads and is the same as if body was run after getTest().
+     * body(t) should only use t, which provides operator<<, generator() and rng utilities.
+     * Test is recorded under its (test, suite) index, so after runTests setTest on it continues it.
+     * Every test checks its own copy of current assumptions, and copies run concurrently: assumptions
+     * should be stateless, as they do not see other tests, and anything they share has to be thread-safe. */
+    template<typename Fun>
+    void addTest(Fun && body) {
+        writer.flush();
+        assumptions.resetTest();
+        auto test = TestcaseManagerT::deferTest();
+        deferred.push_back({test.filename, [test = std::move(test), assumptions = assumptions, body = std::forward<Fun>(body)]() mutable {
+            typename TestcaseManagerT::stream_type stream(test.filename);
+            DeferredTest<TestcaseT, AssumptionsManagerT<TestcaseT>> deferred_test{stream, test.generator, assumptions, test.filename};
+            body(deferred_test);
+            return deferred_test.assumptionsHeld();
+        }});
+    }
+
+    // generates tests registered with addTest, each one to its own stream;
+    // failed assumptions are reported when all tests are written, then program exits like after assume
+    void runTests(unsigned threads = std::thread::hardware_concurrency()) {
+        std::vector<char> held(deferred.size());
+        detail::parallel_for(deferred.size(), threads, [this, &held](std::size_t i) {
+            held[i] = static_cast<char>(deferred[i].run());
+        });
+        bool all_held = true;
+        for(std::size_t i = 0; i < deferred.size(); ++i) {
+            if(held[i] == 0) {
+                std::cerr << "Assumption failed for " << deferred[i].filename << '\n';
+                all_held = false;
+            }
+        }
+        deferred.clear();
+        assume(all_held);
+    }
+
+    template<typename T>
+    auto generateFromSchema(Generating<T> const & schema) {
+        return schema.generate(generator());
+    }
+
+    // writes buffered output of current test to its stream, which is otherwise done when test is left
+    void flush() {
+        writer.flush();
+        output.flush();
+    }
+
+    // integers, strings, sequences and graphs are formatted by fast Writer; while stream format is
+    // changed (std::setw, std::hex, ...) all but graphs are formatted by stream, graphs stay decimal;
+    // Writer keeps its buffer until test is left, stream prints something or flush() is called
+    template<typename T>
+    Testing & operator<<(T const & out) {
+        if constexpr(std::is_same_v<T, TestcaseT>) {
+            if(!checkSoft(out)) {
+                std::cerr << "Assumption failed for " << this->TestcaseManagerT::getFilename() << '\n';
+                assume(false);
+            }
+        }
+        if constexpr(is_generating<T>::value) {
+            detail::print(writer, output, generateFromSchema(out));
+        } else {
+            detail::print(writer, output, out);
+        }
+        return *this;
+    }
+
+    template<typename AssT>
+    void assumptionGlobal(AssT && fun) {
+        assumptions.setGlobal(std::forward<AssT>(fun));
+    }
+
+    template<typename AssT>
+    void assumptionSuite(AssT && fun) {
+        assumptions.setSuite(std::forward<AssT>(fun));
+    }
+
+    template<typename AssT>
+    void assumptionTest(AssT && fun) {
+        assumptions.setTest(std::forward<AssT>(fun));
+    }
+
+    bool checkSoft(TestcaseT const & tc) {
+        return assumptions.check(tc);
+    }
+
+    bool checkHard(TestcaseT const & tc) {
+        assume(checkSoft(tc));
+        return true;
+    }
+};
+
+/* ==================== checks.hpp ====================*/
+
+/* Graph checkers are function objects returning bool for Graph or CsrGraph, so they can be used as
+ * assumptions and combined with && and ||, e.g. t.assumptionGlobal(IsConnected{} && IsSimple{}).
+ * All of them are iterative and run in O(n + m). Every checker keeps its own scratch buffers,
+ * which grow to the largest graph checked and are reused by later calls. */
+
+template<typename GraphT, std::enable_if_t<detail::is_graph_v<GraphT>, int> = 0>
+[[nodiscard]] std::size_t countEdges(GraphT const & g) {
+    std::size_t res = 0;
+    detail::for_each_edge(g, [&res](uint /*unused*/, uint /*unused*/) { ++res; });
+    return res;
+}
+
+namespace detail {
+
+// per-vertex marks which need no clearing between calls: mark is current if it is not older than stamp
+class CheckScratch {
+    std::vector<uint64_t> marks{};
+    uint64_t last{0};
+
+public:
+    std::vector<uint> stack{};
+
+    // marks of n vertices, all of them older than any stamp returned later by fresh()
+    std::vector<uint64_t> & prepare(std::size_t n) {
+        if(marks.size() < n) { marks.resize(n, 0); }
+        stack.clear();
+        return marks;
+    }
+
+    [[nodiscard]] uint64_t fresh() noexcept {
+        return ++last;
+    }
+};
+
+// number of connected components by iterative DFS, stops as soon as there are more than limit
+template<typename GraphT>
+std::size_t count_components(GraphT const & g, CheckScratch & scratch, std::size_t limit = SIZE_MAX) {
+    auto const n = g.size();
+    auto & marks = scratch.prepare(n);
+    auto const stamp = scratch.fresh();
+    std::size_t components = 0;
+    for(uint s = 0; s < n && components <= limit; ++s) {
+        if(marks[s] == stamp) { continue; }
+        ++components;
+        marks[s] = stamp;
+        scratch.stack.push_back(s);
+        while(!scratch.stack.empty()) {
+            auto const w = scratch.stack.back();
+            scratch.stack.pop_back();
+            for(auto v : g[w]) {
+                if(marks[v] != stamp) {
+                    marks[v] = stamp;
+                    scratch.stack.push_back(v);
+                }
+            }
+        }
+    }
+    return components;
+}
+
+} /* namespace detail */
+
+// graph without vertices counts as connected
+class IsConnected {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        return detail::count_components(g, scratch, 1) <= 1;
+    }
+};
+
+// no loops and no multi-edges
+class IsSimple {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        auto const n = g.size();
+        auto & marks = scratch.prepare(n);
+        for(uint w = 0; w < n; ++w) {
+            auto const stamp = scratch.fresh();
+            for(auto v : g[w]) {
+                if(v == w || marks[v] == stamp) { return false; }
+                marks[v] = stamp;
+            }
+        }
+        return true;
+    }
+};
+
+// acyclic, i.e. number of edges is n - (number of components); loops and multi-edges are cycles
+class IsForest {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        return countEdges(g) + detail::count_components(g, scratch) == g.size();
+    }
+};
+
+// connected and acyclic
+class IsTree {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        return g.size() >= 1 && countEdges(g) == g.size() - 1 && detail::count_components(g, scratch, 1) == 1;
+    }
+};
+
+// vertices can be 2-coloured so that every edge joins different colours, iterative DFS
+class IsBipartite {
+    detail::CheckScratch scratch;
+
+public:
+    template<typename GraphT>
+    bool operator()(GraphT const & g) {
+        auto const n = g.size();
+        auto & marks = scratch.prepare(n);
+        // colour c of vertex visited in this call is stored as base + c
+        auto const base = scratch.fresh();
+        static_cast<void>(scratch.fresh());
+        for(uint s = 0; s < n; ++s) {
+            if(marks[s] >= base) { continue; }
+            marks[s] = base;
+            scratch.stack.push_back(s);
+            while(!scratch.stack.empty()) {
+                auto const w = scratch.stack.back();
+                scratch.stack.pop_back();
+                auto const other = marks[w] == base ? base + 1 : base;
+                for(auto v : g[w]) {
+                    if(marks[v] < base) {
+                        marks[v] = other;
+                        scratch.stack.push_back(v);
+                    } else if(marks[v] != other) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// every degree (number of neighbours on the list, loop counted once) in [min:max]
+class DegreeBounds {
+    std::size_t min;
+    std::size_t max;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    DegreeBounds(std::size_t min, std::size_t max) :
+      min{min}, max{max} {}
+
+    template<typename GraphT>
+    bool operator()(GraphT const & g) const {
+        for(auto const & V : g) {
+            if(V.size() < min || V.size() > max) { return false; }
+        }
+        return true;
+    }
+};
+
+// number of edges (loop counted once) in [min:max]
+class EdgeCount {
+    std::size_t min;
+    std::size_t max;
+
+public:
+    //NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    EdgeCount(std::size_t min, std::size_t max) :
+      min{min}, max{max} {}
+
+    explicit EdgeCount(std::size_t m) :
+      EdgeCount{m, m} {}
+
+    template<typename GraphT>
+    bool operator()(GraphT const & g) const {
+        auto const edges = countEdges(g);
+        return min <= edges && edges <= max;
     }
-}
+};
 
 /* ==================== manager.hpp ====================*/
 
@@ -592,8 +3944,29 @@ enum Verbocity {
     VERBOSE = 1
 };
 
+enum Seeding {
+    SEQUENTIAL = 0, // test generators are forked from suite generator in order of first visit
+    INDEXED = 1     // test generator depends only on main seed and (test, suite), so tests can be generated in any order
+};
+
 template<Verbocity Verbose = VERBOSE, typename StreamType = std::ofstream>
 class OIOIOIManager {
+    using index = detail::index;
+
+    struct test_info {
+        std::string filename;
+        gen_type generator;
+        std::optional<StreamType> stream{};
+        bool opened{false};
+        typename std::list<index>::iterator position{}; // in open_streams, valid while stream is open
+
+        test_info(std::string filename, gen_type generator) :
+          filename{std::move(filename)}, generator{generator} {}
+    };
+
+    // streams that can be reopened in append mode are closed when too many of them are open
+    static constexpr bool REOPENABLE = std::is_constructible_v<StreamType, std::string const &, std::ios_base::openmode>;
+
     void changeStream() {
         auto test_name = getFilename();
         if constexpr(Verbose == Verbocity::VERBOSE) {
@@ -601,48 +3974,86 @@ class OIOIOIManager {
         }
         auto it = cases.find(curr_index);
         if(it == cases.end()) {
-            it = cases.try_emplace(curr_index,
-                                   std::piecewise_construct,
-                                   std::forward_as_tuple(std::move(test_name)),
-                                   std::forward_as_tuple(getGeneratorForCurrentTest()))
-                     .first;
+            it = cases.try_emplace(curr_index, std::move(test_name), getGeneratorForCurrentTest()).first;
         }
         curr_test = &it->second;
+        openStream(*curr_test);
+    }
+
+    void openStream(test_info & info) {
+        if constexpr(REOPENABLE) {
+            if(info.stream) {
+                open_streams.splice(open_streams.begin(), open_streams, info.position);
+                return;
+            }
+            while(open_streams.size() >= max_open_streams) {
+                cases.at(open_streams.back()).stream.reset(); // flushes and closes
+                open_streams.pop_back();
+            }
+            if(info.opened) {
+                info.stream.emplace(info.filename, std::ios_base::out | std::ios_base::app);
+            } else {
+                info.stream.emplace(info.filename);
+            }
+            open_streams.push_front(curr_index);
+            info.position = open_streams.begin();
+        } else {
+            if(!info.stream) {
+                info.stream.emplace(info.filename);
+            }
+        }
+        info.opened = true;
     }
 
     gen_type getGeneratorForCurrentTest() {
         auto const current_suite_nr = curr_index.suite;
         auto it = suite_generators.find(current_suite_nr);
         if(it == suite_generators.end()) {
-            it = suite_generators.try_emplace(current_suite_nr, main_generator()).first;
+            it = suite_generators.try_emplace(current_suite_nr, getGeneratorForCurrentSuite()).first;
+        }
+        if(seeding == Seeding::INDEXED) {
+            auto gen = it->second;
+            gen.jump(curr_index.test);
+            return gen;
         }
         return it->second.fork();
     }
 
+    gen_type getGeneratorForCurrentSuite() {
+        if(seeding == Seeding::INDEXED) {
+            auto gen = main_generator;
+            gen.longJump(curr_index.suite);
+            return gen;
+        }
+        return gen_type{main_generator()};
+    }
+
     void clearStream() {
         curr_test = nullptr;
     }
 
-    struct test_info : private std::pair<StreamType, gen_type> {
-        using std::pair<StreamType, gen_type>::pair;
-        [[nodiscard]] StreamType & stream() {
-            return this->first;
-        }
-        [[nodiscard]] gen_type & generator() {
-            return this->second;
-        }
-    };
-    using index = detail::index;
     test_info * curr_test{nullptr};
     index curr_index;
     std::string abbr;
     std::unordered_map<index, test_info, index::hash> cases{};
     std::unordered_map<unsigned, gen_type> suite_generators{};
     gen_type main_generator;
+    Seeding seeding;
+    std::list<index> open_streams{}; // most recently used first
+    std::size_t max_open_streams{DEFAULT_MAX_OPEN_STREAMS};
 
 public:
-    explicit OIOIOIManager(std::string abbr, bool ocen = true, uint64_t seed = TESTGEN_SEED) :
-      curr_index{0U, ocen ? 0U : 1U}, abbr{std::move(abbr)}, main_generator{seed} {}
+    using stream_type = StreamType;
+
+    static constexpr std::size_t DEFAULT_MAX_OPEN_STREAMS = 64;
+
+    struct deferred_test {
+        std::string filename;
+        gen_type & generator;
+    };
+
+    explicit OIOIOIManager(std::string abbr, bool ocen = true, uint64_t seed = TESTGEN_SEED, Seeding seeding = Seeding::SEQUENTIAL) :
+      curr_index{0U, ocen ? 0U : 1U}, abbr{std::move(abbr)}, main_generator{seed}, seeding{seeding} {}
 
     OIOIOIManager() = delete;
     OIOIOIManager(OIOIOIManager const &) = delete;
@@ -663,12 +4074,24 @@ public:
         generator() = gen_type(seed);
     }
 
+    // affects only suites and tests that were not visited yet
+    void setSeeding(Seeding seeding) noexcept {
+        this->seeding = seeding;
+    }
+
+    // least recently used streams above this limit are closed and reopened in append mode when test is visited again
+    // has no effect if StreamType can not be constructed with (filename, openmode)
+    void setMaxOpenStreams(std::size_t limit) noexcept {
+        assume(limit >= 1);
+        max_open_streams = limit;
+    }
+
     [[nodiscard]] StreamType & stream() const {
-        return curr_test->stream();
+        return *curr_test->stream;
     }
 
     [[nodiscard]] gen_type & generator() const {
-        return curr_test->generator();
+        return curr_test->generator;
     }
 
     void isEmpty() const {
@@ -684,6 +4107,22 @@ public:
         this->setTest(curr_index.test + 1, curr_index.suite);
     }
 
+    // moves to next test like nextTest, but instead of opening its stream returns its name and generator,
+    // so test can be generated later, e.g. on another thread; test must not be visited before.
+    // Test is recorded like a visited one: setTest on it later continues its generator and appends to its file.
+    [[nodiscard]] deferred_test deferTest() {
+        curr_index.test++;
+        clearStream();
+        auto test_name = getFilename();
+        if constexpr(Verbose == Verbocity::VERBOSE) {
+            std::cerr << "Deferring: " << test_name << '\n';
+        }
+        auto [it, inserted] = cases.try_emplace(curr_index, test_name, getGeneratorForCurrentTest());
+        assume(inserted);
+        it->second.opened = true;
+        return {std::move(test_name), it->second.generator};
+    }
+
     void nextSuite() {
         curr_index = {0, curr_index.suite + 1};
         clearStream();
@@ -710,216 +4149,6 @@ public:
     }
 };
 
-/* ==================== assumptions.hpp ====================*/
-
-template<typename TestcaseT>
-class AssumptionManager {
-public:
-    // using assumption_t = bool (*)(TestcaseT const &);
-    using assumption_t = std::function<bool(TestcaseT const &)>;
-
-private:
-    static bool empty(TestcaseT const & /*unused*/) {
-        return true;
-    }
-    assumption_t global = empty;
-    assumption_t suite = empty;
-    assumption_t test = empty;
-
-public:
-    template<typename AssT>
-    void setGlobal(AssT && fun) {
-        global = std::forward<AssT>(fun);
-    }
-    template<typename AssT>
-    void setSuite(AssT && fun) {
-        suite = std::forward<AssT>(fun);
-    }
-    template<typename AssT>
-    void setTest(AssT && fun) {
-        test = std::forward<AssT>(fun);
-    }
-    void resetGlobal() {
-        global = empty;
-    }
-    void resetSuite() {
-        suite = empty;
-    }
-    void resetTest() {
-        test = empty;
-    }
-    bool check(TestcaseT const & testcase) {
-        return test(testcase) && suite(testcase) && global(testcase);
-    }
-};
-
-template<typename Fun1T, typename Fun2T>
-auto operator&&(Fun1T && fun1, Fun2T && fun2) {
-    return [f1 = std::forward<Fun1T>(fun1), f2 = std::forward<Fun2T>(fun2)](auto const & testcase) mutable {
-        return f1(testcase) && f2(testcase);
-    };
-}
-
-template<typename Fun1T, typename Fun2T>
-auto operator||(Fun1T && fun1, Fun2T && fun2) {
-    return [f1 = std::forward<Fun1T>(fun1), f2 = std::forward<Fun2T>(fun2)](auto const & testcase) mutable {
-        return f1(testcase) || f2(testcase);
-    };
-}
-
-/* ==================== testing.hpp ====================*/
-
-template<typename TestcaseManagerT, typename TestcaseT = std::false_type, template<typename> typename AssumptionsManagerT = AssumptionManager>
-class Testing : private TestcaseManagerT, public RngUtilities<Testing<TestcaseManagerT, TestcaseT, AssumptionsManagerT>> {
-    TestcaseT updateTestcase() {
-        output.set(this->stream());
-        return TestcaseT{};
-    }
-
-    Output output;
-    AssumptionsManagerT<TestcaseT> assumptions;
-
-public:
-    using TestcaseManagerT::TestcaseManagerT;
-
-    Testing(const Testing &) = delete;
-    Testing(Testing &&) = delete;
-    Testing & operator=(const Testing &) = delete;
-    Testing & operator=(Testing &&) = delete;
-    ~Testing() = default;
-
-    GeneratorWrapper<gen_type> generator() {
-        return GeneratorWrapper<gen_type>{TestcaseManagerT::generator()};
-    }
-
-    void skipTest() {
-        TestcaseManagerT::skipTest();
-        assumptions.resetTest();
-    }
-
-    void nextSuite() {
-        TestcaseManagerT::nextSuite();
-        assumptions.resetSuite();
-        assumptions.resetTest();
-    }
-
-    TestcaseT getTest() {
-        TestcaseManagerT::nextTest();
-        assumptions.resetTest();
-        return updateTestcase();
-    }
-
-    void nextTest() {
-        TestcaseManagerT::nextTest();
-        assumptions.resetTest();
-        updateTestcase();
-    }
-
-    // setTest(test_nr, suite), e.g. zad2c = (3, 2), 4ocen = (4, 0)
-    // resets suite and test assumptions!
-    template<typename T, typename U>
-    TestcaseT setTest(T test_nr, U suite) {
-        TestcaseManagerT::setTest(test_nr, suite);
-        assumptions.resetSuite();
-        assumptions.resetTest();
-        return updateTestcase();
-    }
-
-    template<typename T>
-    auto generateFromSchema(Generating<T> const & schema) {
-        return schema.generate(generator());
-    }
-
-    template<typename T>
-    Testing & operator<<(T const & out) {
-        if constexpr(std::is_same_v<T, TestcaseT>) {
-            if(!checkSoft(out)) {
-                std::cerr << "Assumption failed for " << this->TestcaseManagerT::getFilename() << '\n';
-                assume(false);
-            }
-        }
-        if constexpr(is_generating<T>::value) {
-            output << generateFromSchema(out);
-        } else {
-            output << out;
-        }
-        return *this;
-    }
-
-    template<typename AssT>
-    void assumptionGlobal(AssT && fun) {
-        assumptions.setGlobal(std::forward<AssT>(fun));
-    }
-
-    template<typename AssT>
-    void assumptionSuite(AssT && fun) {
-        assumptions.setSuite(std::forward<AssT>(fun));
-    }
-
-    template<typename AssT>
-    void assumptionTest(AssT && fun) {
-        assumptions.setTest(std::forward<AssT>(fun));
-    }
-
-    bool checkSoft(TestcaseT const & tc) {
-        return assumptions.check(tc);
-    }
-
-    bool checkHard(TestcaseT const & tc) {
-        assume(checkSoft(tc));
-        return true;
-    }
-};
-
-/* ==================== sequence.hpp ====================*/
-
-template<typename T>
-class Sequence : public std::vector<T> {
-    template<typename Gen, std::enable_if_t<std::is_invocable_v<Gen>, int> = 0>
-    static void seqGenerate(Sequence & s, Gen && gen) {
-        std::generate(s.begin(), s.end(), gen);
-    }
-
-    template<typename Gen, std::enable_if_t<std::is_invocable_v<Gen, unsigned>, int> = 0>
-    static void seqGenerate(Sequence & s, Gen && gen) {
-        std::generate(s.begin(), s.end(), [&gen, cnt = 0U]() mutable { return std::invoke(gen, cnt++); });
-    }
-
-public:
-    using std::vector<T>::vector;
-
-    template<typename Gen, typename = std::enable_if_t<std::is_invocable_v<Gen> || std::is_invocable_v<Gen, unsigned>>>
-    Sequence(std::size_t size, Gen && gen) :
-      std::vector<T>(size) {
-        seqGenerate(*this, std::forward<Gen>(gen));
-    }
-
-    Sequence operator+(Sequence const & x) const {
-        Sequence res(this->size() + x.size());
-        auto const it = std::copy(this->begin(), this->end(), res.begin());
-        std::copy(x.begin(), x.end(), it);
-        return res;
-    }
-
-    Sequence & operator+=(Sequence const & x) {
-        auto const old_size = this->size();
-        this->resize(old_size + x.size());
-        std::copy(x.begin(), x.end(), this->begin() + old_size);
-        return *this;
-    }
-
-    friend std::ostream & operator<<(std::ostream & s, Sequence const & x) {
-        auto it = x.begin();
-        auto const end = x.end();
-        if(it == end) { return s; }
-        s << *it++;
-        while(it != end) {
-            s << ' ' << *it++;
-        }
-        return s;
-    }
-};
-
 } /* namespace test */
 
 #endif /* TESTGEN_HPP_ */
@@ -0,0 +1,116 @@
+#include <doctest.h>
+
+#include <testgen/assumptions.hpp>
+#include <testgen/checks.hpp>
+using namespace std;
+using namespace test;
+
+TEST_CASE("test-count-edges") {
+    CHECK(countEdges(Graph(5)) == 0);
+    CHECK(countEdges(Clique(10).generate()) == 45);
+    Graph g(3, edge_list_t{{0, 0}, {0, 1}, {0, 1}, {1, 2}});
+    CHECK(countEdges(g) == 4);
+    CHECK(countEdges(CsrGraph(g)) == 4);
+}
+
+TEST_CASE("test-connected") {
+    IsConnected connected;
+    CHECK(connected(Graph()));
+    CHECK(connected(Graph(1)));
+    CHECK_FALSE(connected(Graph(2)));
+    CHECK(connected(Cycle(10).generate()));
+    CHECK_FALSE(connected(merge(Path(5).generate(), Path(5).generate())));
+    CHECK(connected(merge(Path(5).generate(), Path(5).generate(), {{4, 0}})));
+    CHECK(connected(CsrGraph(Star(10).generate())));
+}
+
+TEST_CASE("test-simple") {
+    IsSimple simple;
+    CHECK(simple(Clique(10).generate()));
+    CHECK_FALSE(simple(Graph(2, edge_list_t{{0, 1}, {1, 0}})));
+    CHECK_FALSE(simple(Graph(2, edge_list_t{{0, 1}, {1, 1}})));
+    CHECK(simple(Graph(2, edge_list_t{{0, 1}})));
+    CHECK(simple(CsrGraph(Path(10).generate())));
+}
+
+TEST_CASE("test-forest-and-tree") {
+    IsForest forest;
+    IsTree tree;
+    gen_type gen{1};
+    Graph const t = Tree(100).generate(gen);
+    CHECK(forest(t));
+    CHECK(tree(t));
+    Graph const two = merge(t, t);
+    CHECK(forest(two));
+    CHECK_FALSE(tree(two));
+    CHECK_FALSE(forest(Cycle(3).generate()));
+    CHECK_FALSE(tree(Cycle(3).generate()));
+    CHECK_FALSE(forest(Graph(2, edge_list_t{{0, 1}, {0, 1}})));
+    CHECK_FALSE(forest(Graph(1, edge_list_t{{0, 0}})));
+    CHECK(forest(Graph(3)));
+    CHECK_FALSE(tree(Graph(3)));
+    CHECK(tree(Graph(1)));
+    CHECK_FALSE(tree(Graph()));
+    // graph with n - 1 edges which is not connected
+    CHECK_FALSE(tree(Graph(4, edge_list_t{{0, 1}, {1, 2}, {2, 0}})));
+}
+
+TEST_CASE("test-bipartite") {
+    IsBipartite bipartite;
+    gen_type gen{2};
+    CHECK(bipartite(Cycle(10).generate()));
+    CHECK_FALSE(bipartite(Cycle(11).generate()));
+    CHECK(bipartite(BipartiteGnp(30, 40, 0.3).generate(gen)));
+    CHECK(bipartite(Tree(1000).generate(gen)));
+    CHECK_FALSE(bipartite(Graph(1, edge_list_t{{0, 0}})));
+    CHECK(bipartite(Graph(5)));
+    CHECK_FALSE(bipartite(merge(Path(4).generate(), Clique(3).generate())));
+}
+
+TEST_CASE("test-degree-and-edge-bounds") {
+    CHECK(DegreeBounds(2, 2)(Cycle(10).generate()));
+    CHECK_FALSE(DegreeBounds(2, 2)(Path(10).generate()));
+    CHECK(DegreeBounds(1, 9)(Star(10).generate()));
+    CHECK_FALSE(DegreeBounds(0, 8)(Star(10).generate()));
+    CHECK(EdgeCount(9)(Path(10).generate()));
+    CHECK_FALSE(EdgeCount(10)(Path(10).generate()));
+    CHECK(EdgeCount(5, 15)(Cycle(10).generate()));
+    CHECK_FALSE(EdgeCount(11, 15)(Cycle(10).generate()));
+}
+
+TEST_CASE("test-deep-path") {
+    // recursive DFS would overflow the stack here
+    uint const n = 1'000'000;
+    Graph const path = Path(n).generate();
+    CHECK(IsConnected{}(path));
+    CHECK(IsTree{}(path));
+    CHECK(IsBipartite{}(path));
+}
+
+TEST_CASE("test-checks-reused") {
+    // marks of previous calls must not leak into next ones, also for smaller graphs
+    IsConnected connected;
+    IsBipartite bipartite;
+    IsSimple simple;
+    for(int i = 0; i < 3; ++i) {
+        CHECK(connected(Path(100).generate()));
+        CHECK_FALSE(connected(Graph(50)));
+        CHECK(bipartite(Path(100).generate()));
+        CHECK_FALSE(bipartite(Cycle(7).generate()));
+        CHECK(simple(Clique(20).generate()));
+        CHECK_FALSE(simple(Graph(2, edge_list_t{{0, 1}, {0, 1}})));
+    }
+}
+
+TEST_CASE("test-checks-composed") {
+    AssumptionManager<Graph> manager;
+    manager.setGlobal(IsConnected{} && IsSimple{});
+    manager.setSuite(IsTree{} || EdgeCount(0, 10));
+    CHECK(manager.check(Path(100).generate()));
+    CHECK(manager.check(Cycle(10).generate()));
+    CHECK_FALSE(manager.check(Cycle(11).generate()));
+    CHECK_FALSE(manager.check(Graph(2)));
+    manager.setTest(IsBipartite{} && DegreeBounds(0, 2));
+    CHECK(manager.check(Path(100).generate()));
+    CHECK_FALSE(manager.check(Star(10).generate()));
+}
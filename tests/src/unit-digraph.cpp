@@ -0,0 +1,149 @@
+#include <doctest.h>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include <testgen/digraph.hpp>
+using namespace std;
+using namespace test;
+
+namespace {
+
+// Kahn's algorithm, empty result for digraph with a cycle
+vector<uint> topologicalOrder(Digraph const & g) {
+    auto const n = g.size();
+    vector<uint> indegree(n, 0);
+    for(uint w = 0; w < n; ++w) {
+        for(auto v : g[w]) {
+            ++indegree[v];
+        }
+    }
+    vector<uint> order;
+    for(uint w = 0; w < n; ++w) {
+        if(indegree[w] == 0) { order.push_back(w); }
+    }
+    for(size_t i = 0; i < order.size(); ++i) {
+        for(auto v : g[order[i]]) {
+            if(--indegree[v] == 0) { order.push_back(v); }
+        }
+    }
+    return order.size() == n ? order : vector<uint>{};
+}
+
+size_t reachable(Digraph const & g, uint s, bool reversed = false) {
+    auto const n = g.size();
+    vector<vector<uint>> adj(n);
+    for(uint w = 0; w < n; ++w) {
+        for(auto v : g[w]) {
+            if(reversed) {
+                adj[v].push_back(w);
+            } else {
+                adj[w].push_back(v);
+            }
+        }
+    }
+    vector<bool> vis(n, false);
+    vector<uint> stack{s};
+    vis[s] = true;
+    size_t res = 0;
+    while(!stack.empty()) {
+        auto const w = stack.back();
+        stack.pop_back();
+        ++res;
+        for(auto v : adj[w]) {
+            if(!vis[v]) {
+                vis[v] = true;
+                stack.push_back(v);
+            }
+        }
+    }
+    return res;
+}
+
+bool isSimple(Digraph const & g) {
+    auto arcs = g.getEdges();
+    sort(arcs.begin(), arcs.end());
+    return adjacent_find(arcs.begin(), arcs.end()) == arcs.end()
+           && none_of(arcs.begin(), arcs.end(), [](auto e) { return e.first == e.second; });
+}
+
+} // namespace
+
+TEST_CASE("test-digraph-construct") {
+    Digraph const g(4, {{0, 1}, {2, 1}, {0, 3}, {3, 3}});
+    CHECK(g.size() == 4);
+    CHECK(g.arcCount() == 4);
+    CHECK(vector<uint>(g[0].begin(), g[0].end()) == vector<uint>{1, 3});
+    CHECK(g[1].empty());
+    CHECK(g.getEdges() == edge_list_t{{0, 1}, {0, 3}, {2, 1}, {3, 3}});
+    CHECK(Digraph().size() == 0);
+}
+
+TEST_CASE("test-digraph-permute") {
+    gen_type gen{1};
+    gen_type copy{1};
+    Digraph g(5, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {0, 4}});
+    g.permute(gen);
+    auto const per = get_permutation(5, copy);
+    auto const edges = g.getEdges();
+    set<pair<uint, uint>> const arcs(edges.begin(), edges.end());
+    CHECK(arcs == set<pair<uint, uint>>{{per[0], per[1]}, {per[1], per[2]}, {per[2], per[3]}, {per[3], per[4]}, {per[0], per[4]}});
+}
+
+TEST_CASE("test-random-dag") {
+    gen_type gen{2};
+    for(uint64_t m : {0, 10, 500, 1000, 1225}) {
+        auto const g = RandomDag(50, m).generate(gen);
+        CHECK(g.arcCount() == m);
+        CHECK(isSimple(g));
+        CHECK(topologicalOrder(g).size() == 50);
+    }
+    auto const sorted = RandomDag(100, 2000, false).generate(gen);
+    for(auto [a, b] : sorted.getEdges()) {
+        REQUIRE(a < b);
+    }
+    CHECK(RandomDag(30, 435, false).generate(gen).getEdges().size() == 435);
+}
+
+TEST_CASE("test-functional-graph") {
+    gen_type gen{3};
+    auto const g = FunctionalGraph(1000).generate(gen);
+    CHECK(g.size() == 1000);
+    for(uint w = 0; w < 1000; ++w) {
+        REQUIRE(g[w].size() == 1);
+    }
+    set<uint> targets;
+    for(auto [a, b] : g.getEdges()) {
+        targets.insert(b);
+    }
+    CHECK(targets.size() > 500); // about 632 on average
+    CHECK(targets.size() < 750);
+}
+
+TEST_CASE("test-tournament") {
+    gen_type gen{4};
+    uint const n = 60;
+    auto const g = Tournament(n).generate(gen);
+    CHECK(g.arcCount() == n * (n - 1) / 2);
+    set<pair<uint, uint>> pairs;
+    for(auto [a, b] : g.getEdges()) {
+        pairs.emplace(min(a, b), max(a, b));
+    }
+    CHECK(pairs.size() == n * (n - 1) / 2);
+    CHECK(isSimple(g));
+}
+
+TEST_CASE("test-strongly-connected") {
+    gen_type gen{5};
+    for(uint64_t m : {100, 101, 1000, 5000, 9900}) {
+        auto const g = StronglyConnected(100, m).generate(gen);
+        CHECK(g.arcCount() == m);
+        CHECK(isSimple(g));
+        CHECK(reachable(g, 0) == 100);
+        CHECK(reachable(g, 0, true) == 100);
+    }
+    CHECK(StronglyConnected(1, 0).generate(gen).size() == 1);
+    CHECK(StronglyConnected(2, 2).generate(gen).arcCount() == 2);
+    CHECK(StronglyConnected(3, 6).generate(gen).arcCount() == 6);
+}
@@ -1,6 +1,9 @@
 #include <doctest.h>
 
 #include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
 
 #include <testgen/rand.hpp>
 using namespace test;
@@ -25,3 +28,131 @@ TEST_CASE("test_single") {
         CHECK(dist(gen) == 7);
     }
 }
+
+TEST_CASE("test_chi_squared") {
+    // 99.9% quantile of chi-squared distribution with 9 degrees of freedom is 27.88
+    constexpr int BUCKETS = 10;
+    constexpr int SAMPLES = 100000;
+    gen_type gen{14};
+    auto const chi_squared = [&](auto && sample) {
+        array<int, BUCKETS> cnt{};
+        for(int i = 0; i < SAMPLES; i++) {
+            cnt[sample()]++;
+        }
+        double res = 0;
+        double const expected = static_cast<double>(SAMPLES) / BUCKETS;
+        for(auto c : cnt) {
+            res += (c - expected) * (c - expected) / expected;
+        }
+        return res;
+    };
+    CHECK(chi_squared([&] { return uni_dist<int>::gen(0, BUCKETS - 1, gen); }) < 27.88);
+    // range above 2^32, buckets are [k * 2^60, (k + 1) * 2^60)
+    CHECK(chi_squared([&] { return uni_dist<uint64_t>::gen(0, (static_cast<uint64_t>(BUCKETS) << 60U) - 1, gen) >> 60U; }) < 27.88);
+}
+
+TEST_CASE("test_full_range") {
+    gen_type gen{15};
+    bool negative = false;
+    bool positive = false;
+    for(int i = 0; i < 100; i++) {
+        auto const v = uni_dist<int32_t>::gen(INT32_MIN, INT32_MAX, gen);
+        negative |= v < 0;
+        positive |= v > 0;
+        CHECK(uni_dist<int64_t>::gen(INT64_MAX, INT64_MAX, gen) == INT64_MAX);
+        CHECK(uni_dist<int64_t>::gen(INT64_MIN, INT64_MIN + 1, gen) <= INT64_MIN + 1);
+    }
+    CHECK(negative);
+    CHECK(positive);
+    gen_type g1{16};
+    gen_type g2{16};
+    CHECK(uni_dist<uint64_t>::gen(0, UINT64_MAX, g1) == g2());
+}
+
+TEST_CASE("test_legacy_modulo") {
+    setSampling(Sampling::LEGACY_MODULO);
+    gen_type g1{17};
+    gen_type g2{17};
+    for(int i = 0; i < 1000; i++) {
+        CHECK(uni_dist<int>::gen(-3, 1000, g1) == static_cast<int>(g2() % 1004) - 3);
+    }
+    vector<int> V(100);
+    uni_dist<int>(5, 7).fill(V.data(), V.size(), g1);
+    for(auto v : V) {
+        CHECK(v == static_cast<int>(g2() % 3) + 5);
+    }
+    setSampling(Sampling::LEMIRE);
+}
+
+TEST_CASE("test_fill_same_as_scalar") {
+    for(auto sampling : {Sampling::LEMIRE, Sampling::LEGACY_MODULO}) {
+        setSampling(sampling);
+        gen_type g1{18};
+        gen_type g2{18};
+        // large range, so rejections are frequent
+        auto const to = INT64_MAX / 3 * 2;
+        vector<int64_t> V(1000);
+        uni_dist<int64_t>(0, to).fill(V.data(), V.size(), g1);
+        for(auto v : V) {
+            CHECK(v == uni_dist<int64_t>::gen(0, to, g2));
+        }
+        CHECK(g1() == g2());
+    }
+    setSampling(Sampling::LEMIRE);
+}
+
+TEST_CASE("test_shuffle_same_as_scalar") {
+    // hides bulk generation, so shuffle_sequence draws words one by one
+    struct scalar_gen {
+        gen_type gen;
+        uint64_t operator()() {
+            return gen();
+        }
+    };
+    for(auto sampling : {Sampling::LEMIRE, Sampling::LEGACY_MODULO}) {
+        setSampling(sampling);
+        vector<int> V(1000);
+        iota(begin(V), end(V), 0);
+        auto W = V;
+        gen_type g1{19};
+        scalar_gen g2{gen_type{19}};
+        shuffle_sequence(begin(V), end(V), g1);
+        shuffle_sequence(begin(W), end(W), g2);
+        CHECK(V == W);
+        CHECK(g1() == g2());
+    }
+    setSampling(Sampling::LEMIRE);
+}
+
+TEST_CASE("test_discrete_dist") {
+    // 99.9% quantile of chi-squared distribution with 4 degrees of freedom is 18.47
+    constexpr int SAMPLES = 100000;
+    vector<uint64_t> const weights{5, 0, 1, 10, 3, 1};
+    discrete_dist const dist(weights);
+    gen_type gen{20};
+    array<int, 6> cnt{};
+    for(int i = 0; i < SAMPLES; i++) {
+        cnt[dist(gen)]++;
+    }
+    CHECK(cnt[1] == 0);
+    double res = 0;
+    for(size_t i = 0; i < weights.size(); i++) {
+        if(weights[i] == 0) { continue; }
+        double const expected = static_cast<double>(SAMPLES) * static_cast<double>(weights[i]) / 20;
+        res += (cnt[i] - expected) * (cnt[i] - expected) / expected;
+    }
+    CHECK(res < 18.47);
+    CHECK(discrete_dist({0, 0, 7})(gen) == 2);
+}
+
+TEST_CASE("test_discrete_dist_fill_same_as_scalar") {
+    discrete_dist const dist({4, 1, 0, 1000, 17});
+    gen_type g1{21};
+    gen_type g2{21};
+    vector<uint> V(1000);
+    dist.fill(V.data(), V.size(), g1);
+    for(auto v : V) {
+        CHECK(v == dist(g2));
+    }
+    CHECK(g1() == g2());
+}
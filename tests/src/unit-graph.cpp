@@ -1,5 +1,6 @@
 #include <doctest.h>
 
+#include <map>
 #include <set>
 
 #include <testgen/graph.hpp>
@@ -154,6 +155,20 @@ TEST_CASE("test_cycle_random") {
     CHECK(isConnected(g));
 }
 
+TEST_CASE("test_star") {
+    for(uint const n : {1U, 2U, 50U}) {
+        Graph const g = Star(n).generate();
+        CHECK(g.size() == n);
+        CHECK(g.getEdges().size() == n - 1);
+        CHECK(g[0].size() == n - 1);
+        for(uint i = 1; i < n; i++) {
+            CHECK(g[i] == vector<uint>{0});
+        }
+        gen_type gen{0};
+        CHECK(Star(n).generate(gen).getEdges().size() == n - 1);
+    }
+}
+
 TEST_CASE("test_merge") {
     int const n = 50;
     Graph const a = Clique(n).generate();
@@ -254,4 +269,677 @@ TEST_CASE("test_identify") {
     Graph const P = Path(3).generate();
     Graph const exp = merge(Clique(3).generate(), Graph(1), {{0, 0}, {2, 0}});
     CHECK(identify(g, P, {{0, 0}, {2, 2}}) == exp);
-}
\ No newline at end of file
+}
+
+TEST_CASE("test_contract_loops") {
+    Graph g(4, vector<pair<uint, uint>>{{0, 1}, {1, 1}, {1, 2}, {1, 2}, {2, 3}});
+    CHECK(g.contract(0, 1) == 0);
+    CHECK(g == Graph(4, vector<pair<uint, uint>>{{0, 0}, {0, 2}, {0, 2}, {2, 3}}));
+    CHECK(g[1].empty());
+}
+
+TEST_CASE("test_contract_order") {
+    Graph g(4, vector<pair<uint, uint>>{{2, 1}, {1, 3}, {0, 1}, {2, 3}, {0, 2}});
+    g.contract(0, 1);
+    CHECK(g[0] == vector<uint>{2, 2, 3, 0});
+    CHECK(g[1].empty());
+    CHECK(g[2] == vector<uint>{3, 0, 0});
+    CHECK(g[3] == vector<uint>{2, 0});
+}
+
+TEST_CASE("test_contract_batched") {
+    gen_type gen{5};
+    Graph const tree = Tree(300).generate(gen);
+    vector<pair<uint, uint>> pairs;
+    for(uint i = 0; i < 100; ++i) {
+        pairs.emplace_back(i, 299 - i);
+    }
+    Graph one_by_one = tree;
+    for(auto [a, b] : pairs) {
+        one_by_one.contract(a, b);
+    }
+    Graph batched = tree;
+    auto const representative = batched.contract(pairs);
+    CHECK(batched == one_by_one);
+    CHECK(representative[299] == 0);
+    CHECK(representative[150] == 150);
+}
+
+TEST_CASE("test_contract_transitive") {
+    Graph g = Path(5).generate();
+    auto const representative = g.contract({{0, 2}, {4, 2}});
+    CHECK(representative == vector<uint>{4, 1, 4, 3, 4});
+    g.makeSimple();
+    CHECK(g == Graph(5, vector<pair<uint, uint>>{{1, 4}, {3, 4}}));
+}
+
+TEST_CASE("test_identify_many") {
+    gen_type gen{8};
+    Graph const A = Tree(200).generate(gen);
+    Graph const B = Tree(200).generate(gen);
+    vector<pair<int, int>> pairs;
+    for(int i = 0; i < 200; i += 3) {
+        pairs.emplace_back(i, 199 - i);
+    }
+    Graph expected = merge(A, B, {});
+    for(auto [a, b] : pairs) {
+        expected.contract(a, 200 + b);
+    }
+    expected.removeIsolated();
+    expected.makeSimple();
+    Graph const result = identify(A, B, pairs);
+    CHECK(result.size() == 400 - pairs.size());
+    CHECK(result == expected);
+}
+
+bool sameGraph(CsrGraph const & a, Graph const & b) {
+    if(a.size() != b.size()) { return false; }
+    for(uint i = 0; i < a.size(); ++i) {
+        if(!equal(a[i].begin(), a[i].end(), b[i].begin(), b[i].end())) { return false; }
+    }
+    return true;
+}
+
+TEST_CASE("test_csr_from_edges") {
+    vector<pair<uint, uint>> const edges{{0, 1}, {2, 1}, {3, 3}, {1, 3}, {0, 1}};
+    CsrGraph const csr(5, edges);
+    Graph const g(5, edges);
+    CHECK(csr.size() == 5);
+    CHECK(sameGraph(csr, g));
+    CHECK(csr[1].size() == 4);
+    CHECK(csr[3].size() == 2);
+    CHECK(csr[4].empty());
+    CHECK(csr.getEdges() == g.getEdges());
+    CHECK(sameGraph(CsrGraph(g), g));
+    CHECK(sameGraph(CsrGraph(3, {{0, 1}, {1, 2}}), Path(3).generate()));
+    CHECK(CsrGraph().size() == 0);
+}
+
+TEST_CASE("test_csr_iteration") {
+    Graph const g = Clique(5).generate();
+    CsrGraph const csr(g);
+    size_t vertices = 0;
+    size_t degrees = 0;
+    for(auto const & V : csr) {
+        ++vertices;
+        for(auto v : V) {
+            degrees += v < 5 ? 1 : 0;
+        }
+    }
+    CHECK(vertices == 5);
+    CHECK(degrees == 20);
+}
+
+// Graph::permute before it was made in-place
+Graph permuteCopy(Graph const & g, gen_type & gen) {
+    auto const n = g.size();
+    auto const per = get_permutation(n, gen);
+    Graph new_G(n);
+    for(uint w = 0; w < n; ++w) {
+        for(auto v : g[w]) {
+            new_G[per[w]].push_back(per[v]);
+        }
+    }
+    for(uint w = 0; w < n; ++w) {
+        shuffle_sequence(begin(new_G[w]), end(new_G[w]), gen);
+    }
+    return new_G;
+}
+
+TEST_CASE("test_permute_in_place") {
+    gen_type gen{17};
+    Graph const g = Tree(2000).generate(gen);
+    gen_type a{6};
+    gen_type b{6};
+    Graph permuted = g;
+    permuted.permute(a);
+    Graph const expected = permuteCopy(g, b);
+    CHECK(equal(permuted.begin(), permuted.end(), expected.begin(), expected.end()));
+    CHECK(a() == b());
+}
+
+TEST_CASE("test_permute_no_shuffle") {
+    Graph g = Star(100).generate();
+    gen_type gen{2};
+    g.permute(gen, false);
+    auto const center = static_cast<uint>(find_if(g.begin(), g.end(), [](auto const & V) { return V.size() == 99; }) - g.begin());
+    CHECK(center < 100);
+    for(uint i = 0; i < 100; ++i) {
+        if(i != center) {
+            CHECK(g[i] == vector<uint>{center});
+        }
+    }
+    Graph path = Path(1000).generate();
+    CsrGraph csr(path);
+    gen_type a{9};
+    gen_type b{9};
+    path.permute(a, false);
+    csr.permute(b, false);
+    CHECK(sameGraph(csr, path));
+    CHECK(a() == b());
+}
+
+TEST_CASE("test_csr_permute") {
+    gen_type gen{7};
+    Graph g = Tree(1000).generate(gen);
+    CsrGraph csr(g);
+    gen_type a{3};
+    gen_type b{3};
+    g.permute(a);
+    csr.permute(b);
+    CHECK(sameGraph(csr, g));
+    CHECK(a() == b());
+}
+
+TEST_CASE("test_generate_csr") {
+    auto const check = [](auto const & schema) {
+        gen_type a{11};
+        gen_type b{11};
+        CHECK(sameGraph(schema.generateCsr(a), schema.generate(b)));
+        CHECK(a() == b());
+    };
+    check(Tree(1000));
+    check(Tree(1000, 5));
+    check(Path(100));
+    check(Cycle(100));
+    check(Clique(30));
+    check(Star(100));
+    CHECK(sameGraph(Cycle(10).generateCsr(), Cycle(10).generate()));
+    CHECK(isConnected(Star(10).generate(), true));
+}
+
+TEST_CASE("test_edge_list") {
+    EdgeListGraph g(4);
+    g.addEdge(0, 1);
+    g.addEdge(3, 2);
+    CHECK(g.size() == 4);
+    CHECK(g.getEdges() == vector<pair<uint, uint>>{{0, 1}, {3, 2}});
+    CHECK(g.toGraph() == Graph(4, vector<pair<uint, uint>>{{0, 1}, {2, 3}}));
+    CHECK(sameGraph(g.toCsr(), g.toGraph()));
+    g.relabel({3, 2, 1, 0});
+    CHECK(g.getEdges() == vector<pair<uint, uint>>{{3, 2}, {0, 1}});
+    Graph const clique = Clique(5).generate();
+    CHECK(EdgeListGraph(clique).toGraph() == clique);
+}
+
+TEST_CASE("test_edge_list_permute") {
+    gen_type gen{21};
+    EdgeListGraph g = Path(1000).generateEdgeList(gen);
+    CHECK(g.getEdges().size() == 999);
+    auto const G = g.toGraph();
+    CHECK(isConnected(G, true));
+    int ends = 0;
+    for(auto const & V : G) {
+        ends += V.size() == 1 ? 1 : 0;
+    }
+    CHECK(ends == 2);
+    auto const & edges = g.getEdges();
+    auto const forward = count_if(edges.begin(), edges.end(), [](auto e) { return e.first < e.second; });
+    CHECK(forward > 400);
+    CHECK(forward < 600);
+}
+
+TEST_CASE("test_edge_list_tree") {
+    gen_type a{4};
+    gen_type b{4};
+    CHECK(Tree(500).generateEdgeList(a).toGraph() == Tree(500).generate(b));
+}
+
+TEST_CASE("test_edge_list_merge") {
+    EdgeListGraph const a(Clique(4).generate());
+    EdgeListGraph const b(Path(3).generate());
+    EdgeListGraph const c = merge(a, b, {{0, 0}, {1, 2}});
+    CHECK(c.size() == 7);
+    CHECK(c.toGraph() == merge(Clique(4).generate(), Path(3).generate(), {{0, 0}, {1, 2}}));
+    CHECK(merge(a, b).getEdges().size() == 8);
+    CHECK(merge(a, b, vector<pair<uint, uint>>{{3, 1}}).toGraph() == merge(a.toGraph(), b.toGraph(), {{3, 1}}));
+}
+
+bool isSimple(Graph g) {
+    for(uint i = 0; i < g.size(); ++i) {
+        auto & V = g[i];
+        sort(V.begin(), V.end());
+        if(adjacent_find(V.begin(), V.end()) != V.end() || binary_search(V.begin(), V.end(), i)) { return false; }
+    }
+    return true;
+}
+
+size_t edgeCount(Graph const & g) {
+    return g.getEdges().size();
+}
+
+TEST_CASE("test_pair_from_index") {
+    uint64_t k = 0;
+    for(uint a = 1; a < 200; ++a) {
+        for(uint b = 0; b < a; ++b) {
+            REQUIRE(detail::pair_from_index(k++) == pair<uint, uint>{a, b});
+        }
+    }
+    CHECK(detail::pair_from_index(detail::pairs_count(4'000'000'000U) - 1) == pair<uint, uint>{3'999'999'999U, 3'999'999'998U});
+}
+
+TEST_CASE("test_gnm") {
+    gen_type gen{1};
+    for(uint64_t m : {0, 1, 100, 2000, 4000, 4950}) {
+        Graph const g = Gnm(100, m).generate(gen);
+        CHECK(g.size() == 100);
+        CHECK(edgeCount(g) == m);
+        CHECK(isSimple(g));
+    }
+    CHECK(Gnm(30, 435).generate(gen) == Clique(30).generate());
+    gen_type a{3};
+    gen_type b{3};
+    CHECK(Gnm(1000, 5000).generateEdgeList(a).getEdges() == Gnm(1000, 5000).generateEdgeList(b).getEdges());
+}
+
+TEST_CASE("test_gnm_uniform") {
+    // all 15 graphs with 2 edges on 4 vertices should be equally likely
+    gen_type gen{2};
+    map<vector<pair<uint, uint>>, int> counts;
+    int const rounds = 15000;
+    for(int i = 0; i < rounds; ++i) {
+        auto edges = Gnm(4, 2).generate(gen).getEdges();
+        sort(edges.begin(), edges.end());
+        ++counts[edges];
+    }
+    CHECK(counts.size() == 15);
+    for(auto const & [edges, count] : counts) {
+        CHECK(count > 850);
+        CHECK(count < 1150);
+    }
+}
+
+TEST_CASE("test_gnp") {
+    gen_type gen{4};
+    CHECK(edgeCount(Gnp(100, 0).generate(gen)) == 0);
+    CHECK(Gnp(40, 1).generate(gen) == Clique(40).generate());
+    CHECK(Gnp(1, 0.5).generate(gen).size() == 1);
+    Graph const g = Gnp(2000, 0.01).generate(gen);
+    CHECK(isSimple(g));
+    auto const m = static_cast<double>(edgeCount(g));
+    auto const expected = 0.01 * 2000 * 1999 / 2; // 19990, standard deviation about 140
+    CHECK(m > expected - 700);
+    CHECK(m < expected + 700);
+    // every pair is equally likely, including the first and the last one
+    vector<int> degree(10);
+    for(int i = 0; i < 2000; ++i) {
+        for(auto [a, b] : Gnp(10, 0.1).generate(gen).getEdges()) {
+            ++degree[a];
+            ++degree[b];
+        }
+    }
+    for(auto d : degree) {
+        CHECK(d > 1500);
+        CHECK(d < 2100);
+    }
+}
+
+TEST_CASE("test_bipartite") {
+    gen_type gen{5};
+    auto const check = [](Graph const & g, uint a) {
+        for(auto [x, y] : g.getEdges()) {
+            CHECK(x < a);
+            CHECK(y >= a);
+        }
+        CHECK(isSimple(g));
+    };
+    Graph const g = BipartiteGnm(30, 50, 700).generate(gen);
+    CHECK(g.size() == 80);
+    CHECK(edgeCount(g) == 700);
+    check(g, 30);
+    CHECK(edgeCount(BipartiteGnm(30, 50, 1500).generate(gen)) == 1500);
+    Graph const h = BipartiteGnp(100, 200, 0.1).generate(gen);
+    check(h, 100);
+    CHECK(edgeCount(h) > 1700);
+    CHECK(edgeCount(h) < 2300);
+    CHECK(edgeCount(BipartiteGnp(10, 20, 1).generate(gen)) == 200);
+}
+
+TEST_CASE("test_decode_prufer") {
+    CHECK(decode_prufer({3, 3, 3, 4}) == vector<pair<uint, uint>>{{0, 3}, {1, 3}, {2, 3}, {3, 4}, {4, 5}});
+    CHECK(decode_prufer({}) == vector<pair<uint, uint>>{{0, 1}});
+    CHECK(decode_prufer({0, 0}) == vector<pair<uint, uint>>{{1, 0}, {2, 0}, {0, 3}});
+}
+
+TEST_CASE("test_uniform_tree") {
+    gen_type gen{6};
+    CHECK(UniformTree(1).generate(gen).size() == 1);
+    CHECK(edgeCount(UniformTree(2).generate(gen)) == 1);
+    Graph const g = UniformTree(1000).generate(gen);
+    CHECK(edgeCount(g) == 999);
+    CHECK(isConnected(g, true));
+    // all 16 labelled trees on 4 vertices should be equally likely
+    map<vector<pair<uint, uint>>, int> counts;
+    for(int i = 0; i < 16000; ++i) {
+        auto edges = UniformTree(4).generate(gen).getEdges();
+        sort(edges.begin(), edges.end());
+        ++counts[edges];
+    }
+    CHECK(counts.size() == 16);
+    for(auto const & [edges, count] : counts) {
+        CHECK(count > 850);
+        CHECK(count < 1150);
+    }
+}
+
+TEST_CASE("test_caterpillar") {
+    gen_type gen{7};
+    uint const n = 500;
+    uint const spine = 100;
+    Graph const g = Caterpillar(n, spine).generate(gen);
+    CHECK(isConnected(g, true));
+    for(uint i = spine; i < n; ++i) {
+        REQUIRE(g[i].size() == 1);
+        CHECK(g[i][0] < spine);
+    }
+    CHECK(isConnected(Caterpillar(1, 1).generate(gen)));
+    CHECK(Caterpillar(50, 50).generate(gen) == Path(50).generate());
+}
+
+TEST_CASE("test_broom") {
+    Graph const g = Broom(10, 4).generate();
+    CHECK(isConnected(g, true));
+    CHECK(g[3].size() == 7);
+    CHECK(g[0].size() == 1);
+    CHECK(g[1].size() == 2);
+    gen_type gen{8};
+    Graph const h = Broom(100, 30).generate(gen);
+    CHECK(isConnected(h, true));
+    CHECK(Broom(5, 5).generate() == Path(5).generate());
+}
+
+TEST_CASE("test_bounded_depth_tree") {
+    gen_type gen{9};
+    for(uint depth : {1U, 2U, 5U, 1000U}) {
+        uint const n = 1000;
+        Graph const g = BoundedDepthTree(n, depth).generate(gen);
+        CHECK(isConnected(g, true));
+        vector<uint> level(n, 0);
+        uint height = 0;
+        for(auto [a, b] : BoundedDepthTree(n, depth).generateEdges(gen)) {
+            REQUIRE(a < b);
+            level[b] = level[a] + 1;
+            height = max(height, level[b]);
+        }
+        CHECK(height <= depth);
+    }
+    CHECK(BoundedDepthTree(10, 1).generate(gen) == Star(10).generate());
+}
+
+TEST_CASE("test_radix_sort") {
+    gen_type gen{10};
+    vector<uint64_t> values(100000);
+    for(auto & v : values) {
+        v = gen() >> (gen() % 64);
+    }
+    auto expected = values;
+    sort(expected.begin(), expected.end());
+    detail::radix_sort(values);
+    CHECK(values == expected);
+}
+
+TEST_CASE("test_connected_graph") {
+    gen_type gen{11};
+    for(uint64_t m : {99, 100, 500, 2000, 4000, 4900, 4950}) {
+        Graph const g = ConnectedGraph(100, m).generate(gen);
+        CHECK(g.size() == 100);
+        CHECK(edgeCount(g) == m);
+        CHECK(isSimple(g));
+        CHECK(isConnected(g));
+    }
+    CHECK(ConnectedGraph(1, 0).generate(gen).size() == 1);
+    CHECK(edgeCount(ConnectedGraph(2, 1).generate(gen)) == 1);
+    CHECK(ConnectedGraph(30, 435).generate(gen) == Clique(30).generate());
+}
+
+TEST_CASE("test_connected_graph_extra_edges") {
+    // with n = 4 and m = 4 each of 16 trees gets one of 3 remaining edges, every pair should appear
+    gen_type gen{12};
+    map<pair<uint, uint>, int> counts;
+    for(int i = 0; i < 6000; ++i) {
+        for(auto [a, b] : ConnectedGraph(4, 4).generate(gen).getEdges()) {
+            ++counts[{a, b}];
+        }
+    }
+    CHECK(counts.size() == 6);
+    for(auto const & [edge, count] : counts) {
+        CHECK(count > 3700); // 4 of 6 pairs are used, 4000 on average
+        CHECK(count < 4300);
+    }
+}
+
+namespace {
+
+template<typename SchemaT>
+edge_list_t streamedEdges(SchemaT const & schema, gen_type & gen) {
+    edge_list_t edges;
+    schema.streamEdges(gen, [&edges](uint a, uint b) { edges.emplace_back(a, b); });
+    return edges;
+}
+
+template<typename SchemaT>
+void checkStreamedLikeGenerated(SchemaT const & schema, uint64_t seed) {
+    gen_type gen{seed};
+    gen_type copy{seed};
+    CHECK(streamedEdges(schema, gen) == schema.generateEdges(copy));
+    CHECK(gen() == copy());
+}
+
+} // namespace
+
+TEST_CASE("test_stream_random_graphs") {
+    checkStreamedLikeGenerated(Tree(300), 1);
+    checkStreamedLikeGenerated(Tree(300, 5), 2);
+    checkStreamedLikeGenerated(Gnp(300, 0.05), 3);
+    checkStreamedLikeGenerated(Gnm(300, 2000), 4);
+    checkStreamedLikeGenerated(Gnm(30, 435), 5);
+    checkStreamedLikeGenerated(BipartiteGnp(40, 60, 0.1), 6);
+    checkStreamedLikeGenerated(BipartiteGnm(40, 60, 1000), 7);
+    checkStreamedLikeGenerated(UniformTree(300), 8);
+    checkStreamedLikeGenerated(UniformTree(1), 8);
+    checkStreamedLikeGenerated(Caterpillar(300, 40), 9);
+    checkStreamedLikeGenerated(BoundedDepthTree(300, 3), 10);
+}
+
+TEST_CASE("test_stream_connected_graph") {
+    gen_type gen{11};
+    gen_type copy{11};
+    auto streamed = streamedEdges(ConnectedGraph(100, 700), gen);
+    auto generated = ConnectedGraph(100, 700).generateEdges(copy);
+    for(auto * edges : {&streamed, &generated}) {
+        for(auto & [a, b] : *edges) {
+            if(a > b) { swap(a, b); }
+        }
+        sort(edges->begin(), edges->end());
+    }
+    CHECK(streamed == generated);
+}
+
+TEST_CASE("test_stream_static_graphs") {
+    for(uint64_t seed = 0; seed < 5; ++seed) {
+        gen_type gen{seed};
+        gen_type copy{seed};
+        auto streamed = streamedEdges(Cycle(50), gen);
+        auto const generated = Cycle(50).generateEdgeList(copy);
+        CHECK(Graph(50, streamed) == generated.toGraph());
+    }
+    gen_type gen{6};
+    CHECK(streamedEdges(Clique(20), gen).size() == 190);
+    CHECK(isConnected(Graph(100, streamedEdges(Path(100), gen)), true));
+    CHECK(isConnected(Graph(100, streamedEdges(Star(100), gen)), true));
+    CHECK(isConnected(Graph(100, streamedEdges(Broom(100, 20), gen)), true));
+}
+
+TEST_CASE("test_stream_batches") {
+    gen_type gen{12};
+    gen_type copy{12};
+    vector<size_t> sizes;
+    edge_list_t edges;
+    Gnp(200, 0.1).streamBatches(
+        gen, [&](edge_list_t const & batch) {
+            sizes.push_back(batch.size());
+            edges.insert(edges.end(), batch.begin(), batch.end());
+        },
+        100);
+    CHECK(edges == Gnp(200, 0.1).generateEdges(copy));
+    REQUIRE(!sizes.empty());
+    CHECK(all_of(sizes.begin(), sizes.end() - 1, [](size_t s) { return s == 100; }));
+    CHECK(sizes.back() <= 100);
+    size_t total = 0;
+    Path(1000).streamBatches(gen, [&total](edge_list_t const & batch) { total += batch.size(); });
+    CHECK(total == 999);
+}
+
+TEST_CASE("test_grid") {
+    Graph const g = Grid(3, 4).generate();
+    CHECK(g.size() == 12);
+    CHECK(edgeCount(g) == 17);
+    CHECK(g[0].size() == 2);
+    CHECK(g[5].size() == 4);
+    CHECK(isConnected(g));
+    CHECK(Grid(1, 10).generate() == Path(10).generate());
+    gen_type gen{13};
+    CHECK(edgeCount(Grid(30, 20).generate(gen)) == Grid(30, 20).edgeCount());
+}
+
+TEST_CASE("test_triangulated_grid") {
+    Graph const g = TriangulatedGrid(3, 4).generate();
+    CHECK(edgeCount(g) == 17 + 6);
+    CHECK(isSimple(g));
+    CHECK(g[5].size() == 6);
+    CHECK(TriangulatedGrid(2, 2).generate() == Graph(4, edge_list_t{{0, 1}, {0, 2}, {1, 3}, {2, 3}, {0, 3}}));
+}
+
+TEST_CASE("test_random_triangulation") {
+    gen_type gen{14};
+    for(uint n : {3U, 4U, 10U, 1000U}) {
+        Graph const g = RandomTriangulation(n).generate(gen);
+        CHECK(edgeCount(g) == 3 * n - 6);
+        CHECK(isSimple(g));
+        CHECK(isConnected(g));
+    }
+    CHECK(RandomTriangulation(4).generate(gen) == Clique(4).generate());
+}
+
+TEST_CASE("test_unit_disk_graph") {
+    gen_type gen{15};
+    gen_type copy{15};
+    uint const n = 2000;
+    uint const radius = 30;
+    UnitDiskGraph const schema(n, 1000, radius);
+    auto const points = schema.generatePoints(gen);
+    auto edges = unitDiskEdges(points, radius);
+    CHECK(Graph(n, edges) == schema.generate(copy));
+    // brute force
+    edge_list_t expected;
+    for(uint i = 0; i < n; ++i) {
+        for(uint j = i + 1; j < n; ++j) {
+            auto const dx = static_cast<int64_t>(points[i].first) - points[j].first;
+            auto const dy = static_cast<int64_t>(points[i].second) - points[j].second;
+            if(dx * dx + dy * dy <= int64_t{radius} * radius) { expected.emplace_back(i, j); }
+        }
+    }
+    sort(edges.begin(), edges.end());
+    CHECK(edges == expected);
+    CHECK(!expected.empty());
+    CHECK(unitDiskEdges({{0, 0}, {3, 4}, {3, 5}}, 5) == edge_list_t{{0, 1}, {1, 2}});
+    CHECK(unitDiskEdges({{0, 0}, {4'000'000'000U, 4'000'000'000U}}, 1).empty());
+    // neighbouring cells differ by almost 2^32, squares of differences must not overflow
+    CHECK(unitDiskEdges({{0, 0}, {3'999'999'999U, 3'999'999'999U}}, 2'000'000'000U).empty());
+    CHECK(unitDiskEdges({{0, 0}, {3'999'999'999U, 0}, {1'414'213'562U, 1'414'213'562U}}, 2'000'000'000U) == edge_list_t{{0, 2}});
+}
+
+TEST_CASE("test_chung_lu") {
+    checkStreamedLikeGenerated(ChungLu(vector<uint>(300, 6)), 16);
+    checkStreamedLikeGenerated(ChungLu(vector<uint>(300, 6), false), 17);
+    gen_type gen{18};
+    vector<uint> degrees(2000, 3);
+    degrees[0] = 1000;
+    degrees[1] = 0;
+    // sum is 6997, so 3498 draws
+    Graph const g = ChungLu(degrees).generate(gen);
+    CHECK(isSimple(g));
+    CHECK(edgeCount(g) <= 3498);
+    CHECK(g[0].size() > 600);
+    CHECK(g[1].empty());
+    Graph const h = ChungLu(degrees, false).generate(gen);
+    CHECK(edgeCount(h) > edgeCount(g));
+    for(uint v = 0; v < 2000; ++v) {
+        CHECK(count(h[v].begin(), h[v].end(), v) == 0);
+    }
+    // every draw is a loop
+    CHECK(edgeCount(ChungLu({0, 5}).generate(gen)) == 0);
+    // empty graphs
+    CHECK(edgeCount(ChungLu({0, 0, 0}).generate(gen)) == 0);
+    CHECK(edgeCount(ChungLu({1}).generate(gen)) == 0);
+    CHECK(ChungLu({}).generate(gen).size() == 0);
+}
+
+TEST_CASE("test_barabasi_albert") {
+    checkStreamedLikeGenerated(BarabasiAlbert(300, 3), 19);
+    gen_type gen{20};
+    for(uint k : {1U, 2U, 5U}) {
+        BarabasiAlbert const schema(1000, k);
+        Graph const g = schema.generate(gen);
+        CHECK(edgeCount(g) == schema.edgeCount());
+        CHECK(isSimple(g));
+        CHECK(isConnected(g, k == 1));
+        for(auto const & V : g) {
+            CHECK(V.size() >= k);
+        }
+    }
+    CHECK(BarabasiAlbert(4, 3).generate(gen) == Clique(4).generate());
+    // preferential attachment makes hubs
+    Graph const g = BarabasiAlbert(10000, 2).generate(gen);
+    auto const hub = max_element(g.begin(), g.end(), [](auto const & a, auto const & b) { return a.size() < b.size(); });
+    CHECK(hub->size() > 50);
+}
+
+TEST_CASE("test_configuration_model") {
+    checkStreamedLikeGenerated(ConfigurationModel(vector<uint>(300, 4)), 21);
+    gen_type gen{22};
+    vector<uint> degrees(1000);
+    for(uint v = 0; v < 1000; ++v) {
+        degrees[v] = 1 + v % 7;
+    }
+    degrees[0] = 40;
+    uint64_t repairs = 0;
+    Graph const g = ConfigurationModel(degrees).generate(gen, repairs);
+    CHECK(isSimple(g));
+    for(uint v = 0; v < 1000; ++v) {
+        CHECK(g[v].size() == degrees[v]);
+    }
+    CHECK(repairs > 0);
+    // nothing to repair
+    CHECK(ConfigurationModel({1, 1}).generate(gen, repairs) == Path(2).generate());
+    CHECK(repairs == 0);
+    CHECK(edgeCount(ConfigurationModel(vector<uint>(10, 0)).generate(gen)) == 0);
+}
+
+TEST_CASE("test_random_regular") {
+    gen_type gen{23};
+    for(uint d : {1U, 2U, 3U, 10U}) {
+        Graph const g = RandomRegular(100, d).generate(gen);
+        CHECK(isSimple(g));
+        for(auto const & V : g) {
+            CHECK(V.size() == d);
+        }
+    }
+    // dense, many edges need repair
+    uint64_t repairs = 0;
+    Graph const g = RandomRegular(50, 20).generate(gen, repairs);
+    CHECK(isSimple(g));
+    CHECK(edgeCount(g) == 500);
+    CHECK(repairs > 20);
+    CHECK(edgeCount(RandomRegular(10000, 3).generate(gen)) == 15000);
+    // dense sequences are generated as complement
+    for(uint n : {2U, 5U, 10U, 101U}) {
+        CHECK(RandomRegular(n, n - 1).generate(gen) == Clique(n).generate());
+    }
+    Graph const dense = RandomRegular(30, 25).generate(gen);
+    CHECK(isSimple(dense));
+    for(auto const & V : dense) {
+        CHECK(V.size() == 25);
+    }
+    CHECK(RandomRegular(5, 4).generate(gen) == Clique(5).generate());
+}
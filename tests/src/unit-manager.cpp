@@ -1,6 +1,10 @@
 #include <doctest.h>
 
+#include <algorithm>
+#include <map>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <testgen/manager.hpp>
 using namespace test;
@@ -161,4 +165,99 @@ TEST_CASE("test-skip-test") {
     manager.skipTest();
     manager.nextTest();
     CHECK(manager.stream().str() == "pro1c.in");
-}
\ No newline at end of file
+}
+
+TEST_CASE("test-indexed-seeding") {
+    OIOIOIManager<SILENT, TestStream> in_order("pro", false, 5, INDEXED);
+    vector<uint64_t> expected;
+    for(unsigned suite = 1; suite <= 3; ++suite) {
+        for(unsigned test = 1; test <= 3; ++test) {
+            in_order.setTest(test, suite);
+            expected.push_back(in_order.generator()());
+        }
+    }
+
+    OIOIOIManager<SILENT, TestStream> reversed("pro", false, 5, INDEXED);
+    for(unsigned suite = 3; suite >= 1; --suite) {
+        for(unsigned test = 3; test >= 1; --test) {
+            reversed.setTest(test, suite);
+            CHECK(reversed.generator()() == expected[(suite - 1) * 3 + test - 1]);
+        }
+    }
+
+    OIOIOIManager<SILENT, TestStream> single("pro", false, 5);
+    single.setSeeding(INDEXED);
+    single.setTest(2, 3);
+    CHECK(single.generator()() == expected[7]);
+}
+
+TEST_CASE("test-indexed-seeding-skip") {
+    OIOIOIManager<SILENT, TestStream> all("pro", true, 6, INDEXED);
+    all.nextTest();
+    all.nextTest();
+    auto const second = all.generator()();
+
+    OIOIOIManager<SILENT, TestStream> skipping("pro", true, 6, INDEXED);
+    skipping.skipTest();
+    skipping.nextTest();
+    CHECK(skipping.generator()() == second);
+}
+
+// keeps content of "files" in memory, counts how many of them are open
+class ReopenableStream : public stringstream {
+    string name;
+
+public:
+    static inline map<string, string> files{};
+    static inline int open = 0;
+    static inline int max_open = 0;
+
+    explicit ReopenableStream(string const & name, ios_base::openmode mode = ios_base::out) :
+      name{name} {
+        if((mode & ios_base::app) == 0) {
+            files[name].clear();
+        }
+        max_open = max(max_open, ++open);
+    }
+    ReopenableStream(ReopenableStream const &) = delete;
+    ReopenableStream(ReopenableStream &&) = delete;
+    ReopenableStream & operator=(ReopenableStream const &) = delete;
+    ReopenableStream & operator=(ReopenableStream &&) = delete;
+    ~ReopenableStream() override {
+        files[name] += str();
+        --open;
+    }
+};
+
+TEST_CASE("test-max-open-streams") {
+    vector<uint64_t> expected;
+    {
+        OIOIOIManager<SILENT, ReopenableStream> manager("pro", false);
+        manager.setMaxOpenStreams(2);
+        for(int round = 0; round < 3; ++round) {
+            for(unsigned test = 1; test <= 5; ++test) {
+                manager.setTest(test, 1);
+                manager.stream() << round;
+                if(round == 2) {
+                    expected.push_back(manager.generator()());
+                }
+            }
+        }
+        CHECK(ReopenableStream::max_open == 2);
+    }
+    CHECK(ReopenableStream::open == 0);
+    CHECK(ReopenableStream::files.size() == 5);
+    for(auto const & [name, content] : ReopenableStream::files) {
+        CHECK(content == "012");
+    }
+    // generators are not affected by closing streams
+    OIOIOIManager<SILENT, TestStream> manager("pro", false);
+    for(int round = 0; round < 3; ++round) {
+        for(unsigned test = 1; test <= 5; ++test) {
+            manager.setTest(test, 1);
+            if(round == 2) {
+                CHECK(manager.generator()() == expected[test - 1]);
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <doctest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <testgen/manager.hpp>
+#include <testgen/mapped.hpp>
+#include <testgen/writer.hpp>
+using namespace test;
+using namespace std;
+
+namespace {
+constexpr size_t WINDOW = size_t{1} << 16U;
+using SmallMappedStream = MappedStream<WINDOW>;
+
+string tempFile(string const & name) {
+    return (filesystem::temp_directory_path() / ("testgen-" + name)).string();
+}
+
+string readFile(string const & name) {
+    ifstream in(name, ios_base::binary);
+    return {istreambuf_iterator<char>{in}, istreambuf_iterator<char>{}};
+}
+} // namespace
+
+TEST_CASE("test-mapped-small") {
+    auto const name = tempFile("mapped-small");
+    {
+        SmallMappedStream out(name);
+        CHECK(out.is_open());
+        out << 12 << ' ' << "abc" << '\n';
+    }
+    CHECK(readFile(name) == "12 abc\n");
+    {
+        SmallMappedStream out(name, ios_base::out | ios_base::app);
+        CHECK(out.tellp() == 7);
+    }
+    remove(name.c_str());
+}
+
+TEST_CASE("test-mapped-windows") {
+    auto const name = tempFile("mapped-windows");
+    stringstream expected{};
+    {
+        SmallMappedStream out(name);
+        Writer writer{out};
+        gen_type gen{1};
+        for(int i = 0; i < 50000; ++i) {
+            auto const x = gen();
+            expected << x << '\n';
+            writer << x << '\n';
+        }
+        string const big(3 * WINDOW + 5, 'x');
+        expected << big;
+        writer << big;
+    }
+    CHECK(expected.str().size() > 3 * WINDOW);
+    CHECK(readFile(name) == expected.str());
+    remove(name.c_str());
+}
+
+TEST_CASE("test-mapped-append") {
+    auto const name = tempFile("mapped-append");
+    string const first(WINDOW + 3, 'a');
+    {
+        SmallMappedStream out(name);
+        out << first;
+        out.reserve(10 * WINDOW);
+    }
+    {
+        SmallMappedStream out(name, ios_base::out | ios_base::app);
+        out << "bc";
+    }
+    CHECK(readFile(name) == first + "bc");
+    {
+        SmallMappedStream out(name);
+        out << "d";
+    }
+    CHECK(readFile(name) == "d");
+    remove(name.c_str());
+}
+
+TEST_CASE("test-mapped-close") {
+    auto const name = tempFile("mapped-close");
+    SmallMappedStream out(name);
+    out << "abc";
+    out.close();
+    CHECK_FALSE(out.is_open());
+    CHECK(readFile(name) == "abc");
+    SmallMappedStream bad(tempFile("no-such-dir/file"));
+    CHECK_FALSE(bad.is_open());
+    CHECK(bad.fail());
+    remove(name.c_str());
+}
+
+TEST_CASE("test-mapped-manager") {
+    auto const prefix = tempFile("mapped");
+    {
+        OIOIOIManager<SILENT, SmallMappedStream> manager(prefix, false);
+        manager.setMaxOpenStreams(1);
+        for(int round = 0; round < 2; ++round) {
+            for(unsigned test = 1; test <= 3; ++test) {
+                manager.setTest(test, 1);
+                manager.stream() << round;
+            }
+        }
+    }
+    for(auto const * suffix : {"1a.in", "1b.in", "1c.in"}) {
+        auto const name = prefix + suffix;
+        CHECK(readFile(name) == "01");
+        remove(name.c_str());
+    }
+}
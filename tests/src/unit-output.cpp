@@ -1,6 +1,9 @@
 #include <doctest.h>
 
+#include <algorithm>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <testgen/output.hpp>
 using namespace test;
@@ -111,3 +114,215 @@ TEST_CASE("test-print-tree-shift") {
     printEdgesAsTree(out, G, 1);
     CHECK(out.str() == "1\n1\n1\n");
 }
+
+TEST_CASE("test-print-tree-root") {
+    std::stringstream out{};
+    Graph const G = Path(4).generate();
+    printEdgesAsTree(out, G, 1, 2);
+    CHECK(out.str() == "2\n3\n3\n");
+    std::stringstream parents{};
+    printParents(parents, G, 0, 2);
+    CHECK(parents.str() == "1 2 -1 2\n");
+    std::stringstream parents_shift{};
+    printParents(parents_shift, CsrGraph(G), 1);
+    CHECK(parents_shift.str() == "0 1 2 3\n");
+    std::stringstream edge_list{};
+    printParents(edge_list, EdgeListGraph(G), 1, 3);
+    CHECK(edge_list.str() == "2 3 4 0\n");
+}
+
+TEST_CASE("test-print-deep-tree") {
+    // recursive DFS would overflow the stack here
+    uint const n = 1'000'000;
+    Graph const G = Path(n).generate();
+    std::stringstream out{};
+    printEdgesAsTree(out, G);
+    std::stringstream expected{};
+    {
+        Writer writer{expected};
+        for(uint i = 0; i + 1 < n; ++i) {
+            writer << i << '\n';
+        }
+    }
+    CHECK(out.str() == expected.str());
+}
+
+TEST_CASE("test-writer-integers") {
+    std::stringstream exp{};
+    std::stringstream out{};
+    {
+        Writer writer{out};
+        gen_type gen{3};
+        for(int i = 0; i < 1000; ++i) {
+            auto const v = static_cast<int64_t>(gen());
+            auto const u = gen();
+            auto const w = static_cast<int32_t>(gen());
+            exp << v << ' ' << u << ' ' << w << '\n';
+            writer << v << ' ' << u << ' ' << w << '\n';
+        }
+        exp << INT64_MIN << ' ' << INT64_MAX << ' ' << UINT64_MAX << ' ' << 0 << ' ' << -1 << '\n';
+        writer << INT64_MIN << ' ' << INT64_MAX << ' ' << UINT64_MAX << ' ' << 0 << ' ' << -1 << '\n';
+    }
+    CHECK(out.str() == exp.str());
+}
+
+TEST_CASE("test-writer-like-ostream") {
+    std::stringstream exp{};
+    std::stringstream out{};
+    {
+        Writer writer{out};
+        exp << true << false << 'x' << static_cast<int8_t>('y') << static_cast<uint8_t>('z') << "abc" << std::string("def");
+        writer << true << false << 'x' << static_cast<int8_t>('y') << static_cast<uint8_t>('z') << "abc" << std::string("def");
+    }
+    CHECK(out.str() == exp.str());
+}
+
+TEST_CASE("test-writer-flush") {
+    std::stringstream out{};
+    Writer writer{out};
+    writer << 12 << ' ';
+    CHECK(out.str() == "");
+    writer.flush();
+    CHECK(out.str() == "12 ");
+    std::stringstream other{};
+    writer << 13;
+    writer.set(other);
+    writer << 14;
+    writer.flush();
+    CHECK(out.str() == "12 13");
+    CHECK(other.str() == "14");
+}
+
+TEST_CASE("test-writer-long") {
+    std::stringstream out{};
+    std::string const big(Writer::BUFFER_SIZE * 2 + 7, 'a');
+    {
+        Writer writer{out};
+        writer << 1 << big << 2;
+        for(int i = 0; i < 100000; ++i) {
+            writer << i % 10;
+        }
+    }
+    auto const str = out.str();
+    CHECK(str.size() == big.size() + 2 + 100000);
+    CHECK(str.substr(0, 2) == "1a");
+    CHECK(str.substr(big.size(), 4) == "a201");
+}
+
+TEST_CASE("test-print-graph-writer") {
+    std::stringstream out{};
+    Graph const G = Clique(3).generate();
+    {
+        Writer writer{out};
+        writer << G;
+    }
+    CHECK(out.str() == "0 1\n0 2\n1 2\n");
+}
+
+TEST_CASE("test-print-sequence-writer") {
+    std::stringstream out{};
+    out << Sequence<int>({-1, 2, 3}) << '\n'
+        << Sequence<std::string>({"a", "b"});
+    CHECK(out.str() == "-1 2 3\na b");
+}
+
+TEST_CASE("test-print-csr") {
+    gen_type gen{5};
+    Graph const G = Tree(100).generate(gen);
+    CsrGraph const C(G);
+    std::stringstream graph{};
+    std::stringstream csr{};
+    printEdges(graph, G, 1);
+    printEdges(csr, C, 1);
+    CHECK(graph.str() == csr.str());
+    std::stringstream graph_tree{};
+    std::stringstream csr_tree{};
+    printEdgesAsTree(graph_tree, G);
+    printEdgesAsTree(csr_tree, C);
+    CHECK(graph_tree.str() == csr_tree.str());
+    std::stringstream written{};
+    std::stringstream expected{};
+    {
+        Writer writer{written};
+        writer << C;
+    }
+    printEdges(expected, G);
+    CHECK(written.str() == expected.str());
+}
+
+TEST_CASE("test-print-edge-list") {
+    EdgeListGraph g(3);
+    g.addEdge(2, 0);
+    g.addEdge(0, 1);
+    std::stringstream out{};
+    printEdges(out, g, 1);
+    CHECK(out.str() == "3 1\n1 2\n");
+    std::stringstream tree{};
+    printEdgesAsTree(tree, g);
+    CHECK(tree.str() == "0\n0\n");
+    std::stringstream written{};
+    {
+        Writer writer{written};
+        writer << g;
+    }
+    CHECK(written.str() == "2 0\n0 1\n");
+}
+
+TEST_CASE("test-print-relabelled") {
+    Graph const G = Path(4).generate();
+    RelabelledGraph const R(G, {3, 0, 2, 1});
+    std::stringstream out{};
+    printEdges(out, R, 1);
+    CHECK(out.str() == "4 1\n1 3\n3 2\n");
+    EdgeListGraph const E(G);
+    std::stringstream edges{};
+    {
+        Writer writer{edges};
+        writer << RelabelledGraph(E, {3, 0, 2, 1});
+    }
+    CHECK(edges.str() == "3 0\n0 2\n2 1\n");
+    gen_type gen{1};
+    RelabelledGraph const random(G, gen);
+    auto label = random.label();
+    std::sort(label.begin(), label.end());
+    CHECK(label == std::vector<uint>{0, 1, 2, 3});
+}
+
+TEST_CASE("test-print-edge-stream") {
+    gen_type gen{3};
+    gen_type copy{3};
+    std::stringstream streamed{};
+    printEdges(streamed, edgeStream(Gnp(100, 0.1), gen), 1);
+    std::stringstream expected{};
+    printEdges(expected, Gnp(100, 0.1).generateEdgeList(copy), 1);
+    CHECK(streamed.str() == expected.str());
+    std::stringstream written{};
+    {
+        Writer writer{written};
+        writer << edgeStream(Path(4), gen);
+    }
+    auto const text = written.str();
+    CHECK(std::count(text.begin(), text.end(), '\n') == 3);
+}
+
+TEST_CASE("test-print-weighted") {
+    WeightedGraph G(3);
+    G.addEdge(0, 1, 7);
+    G.addEdge(2, 1, -1'000'000'000'000);
+    std::stringstream out{};
+    printEdges(out, G, 1);
+    CHECK(out.str() == "1 2 7\n3 2 -1000000000000\n");
+    std::stringstream written{};
+    {
+        Writer writer{written};
+        writer << G;
+    }
+    CHECK(written.str() == "0 1 7\n2 1 -1000000000000\n");
+}
+
+TEST_CASE("test-print-digraph") {
+    Digraph const g(3, {{2, 0}, {0, 1}, {2, 1}});
+    std::stringstream out{};
+    printEdges(out, g, 1);
+    CHECK(out.str() == "1 2\n3 1\n3 2\n");
+}
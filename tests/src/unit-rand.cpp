@@ -1,5 +1,6 @@
 #include <doctest.h>
 
+#include <set>
 #include <type_traits>
 
 #include <testgen/rand.hpp>
@@ -98,6 +99,8 @@ TEST_CASE("test-passing-generator-by-ref") {
     } utils;
     utils.randInt(0, 0);
     utils.randLong(0, 0);
+    utils.randInts(3, 0, 0);
+    utils.randLongs(3, 0, 0);
     std::array a = {0, 1, 2};
     utils.shuffle(std::begin(a), std::end(a));
 }
@@ -121,6 +124,8 @@ TEST_CASE("test-passing-generator-by-move") {
     } utils;
     utils.randInt(0, 0);
     utils.randLong(0, 0);
+    utils.randInts(3, 0, 0);
+    utils.randLongs(3, 0, 0);
     std::array a = {0, 1, 2};
     utils.shuffle(std::begin(a), std::end(a));
 }
@@ -138,6 +143,173 @@ TEST_CASE("test-passing-generator-default") {
     } utils;
     utils.randInt(0, 0);
     utils.randLong(0, 0);
+    utils.randInts(3, 0, 0);
+    utils.randLongs(3, 0, 0);
     std::array a = {0, 1, 2};
     utils.shuffle(std::begin(a), std::end(a));
-}
\ No newline at end of file
+}
+
+TEST_CASE("test-fill-same-as-scalar") {
+    gen_type g1{42};
+    gen_type g2{42};
+    std::array<gen_type::result_type, 1000> V{};
+    g1.fill(V);
+    for(auto v : V) {
+        CHECK_EQ(v, g2());
+    }
+    CHECK_EQ(g1(), g2());
+}
+
+TEST_CASE("test-fill-wrapper") {
+    gen_type g1{43};
+    gen_type g2{43};
+    GeneratorWrapper<gen_type> wrapper{g1};
+    std::array<gen_type::result_type, 10> V{};
+    wrapper.fill(V.data(), V.size());
+    for(auto v : V) {
+        CHECK_EQ(v, g2());
+    }
+}
+
+TEST_CASE("test-rng-utilities-bulk") {
+    gen_type g{44};
+    struct rng : public GeneratorWrapper<gen_type>, public RngUtilities<rng> {
+        using GeneratorWrapper::GeneratorWrapper;
+    } rng{g};
+    gen_type exp{44};
+    auto const ints = rng.randInts(1000, -5, 5);
+    for(auto v : ints) {
+        CHECK_EQ(v, uni_dist<int32_t>::gen(-5, 5, exp));
+    }
+    auto const longs = rng.randLongs(1000, 0, INT64_MAX - 1);
+    for(auto v : longs) {
+        CHECK_EQ(v, uni_dist<int64_t>::gen(0, INT64_MAX - 1, exp));
+    }
+}
+
+TEST_CASE("test-simd-lanes") {
+    Xoshiro256ppSimd<4> simd{7};
+    gen_type base{7};
+    std::array<gen_type, 4> lanes{base.fork(), base.fork(), base.fork(), base.fork()};
+    for(int k = 0; k < 100; ++k) {
+        for(auto & lane : lanes) {
+            CHECK_EQ(simd(), lane());
+        }
+    }
+}
+
+TEST_CASE("test-simd-fill-same-as-scalar") {
+    Xoshiro256ppSimd<8> g1{8};
+    Xoshiro256ppSimd<8> g2{8};
+    std::array<uint64_t, 3> head{};
+    std::array<uint64_t, 1001> V{};
+    g1.fill(head);
+    g1.fill(V);
+    for(auto v : head) {
+        CHECK_EQ(v, g2());
+    }
+    for(auto v : V) {
+        CHECK_EQ(v, g2());
+    }
+    CHECK_EQ(g1(), g2());
+}
+
+TEST_CASE("test-simd-fork") {
+    Xoshiro256ppSimd<2> g{9};
+    gen_type base{9};
+    // first fork takes lanes 0 and 1, so g continues with lanes 2 and 3
+    static_cast<void>(g.fork());
+    std::array<gen_type, 4> lanes{base.fork(), base.fork(), base.fork(), base.fork()};
+    for(int k = 0; k < 10; ++k) {
+        CHECK_EQ(g(), lanes[2]());
+        CHECK_EQ(g(), lanes[3]());
+    }
+}
+
+TEST_CASE("test-simd-with-dist") {
+    Xoshiro256ppSimd<4> g{10};
+    std::array V = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto copy = V;
+    shuffle_sequence(std::begin(V), std::end(V), g);
+    CHECK_NE(V, copy); // should pass 1/10!
+    std::sort(std::begin(V), std::end(V));
+    CHECK_EQ(V, copy);
+    std::array<int, 100> W{};
+    uni_dist<int>(1, 6).fill(W.data(), W.size(), g);
+    for(auto w : W) {
+        CHECK_UNARY(1 <= w && w <= 6);
+    }
+}
+
+TEST_CASE("test-jump-n") {
+    gen_type g1{20};
+    gen_type g2{20};
+    for(int i = 0; i < 13; ++i) {
+        g1.jump();
+    }
+    g2.jump(13);
+    CHECK_EQ(g1(), g2());
+    g1.jump(0);
+    CHECK_EQ(g1(), g2());
+}
+
+TEST_CASE("test-jump-additive") {
+    gen_type g1{21};
+    gen_type g2{21};
+    g1.jump(123456789);
+    g1.jump(987654321);
+    g2.jump(123456789 + 987654321);
+    CHECK_EQ(g1(), g2());
+}
+
+TEST_CASE("test-long-jump") {
+    gen_type g1{22};
+    gen_type g2{22};
+    g1.jump(UINT64_C(1) << 63U);
+    g1.jump(UINT64_C(1) << 63U);
+    g2.longJump();
+    CHECK_EQ(g1(), g2());
+    g1.longJump(3);
+    g2.longJump();
+    g2.longJump(2);
+    CHECK_EQ(g1(), g2());
+}
+
+TEST_CASE("test-fork-jump") {
+    gen_type g1{23};
+    gen_type g2{23};
+    for(int i = 0; i < 5; ++i) {
+        [[maybe_unused]] auto const forked = g1.fork();
+    }
+    auto forked = g1.fork();
+    g2.jump(5);
+    CHECK_EQ(forked(), g2());
+}
+
+TEST_CASE("test-index-set-erase") {
+    // few slots, so that keys collide and probe sequences wrap around
+    detail::IndexSet set(4);
+    for(uint64_t key : {3, 11, 19, 27, 5, 100, 200}) {
+        set.insert(key);
+    }
+    CHECK(set.erase(11));
+    CHECK_FALSE(set.erase(11));
+    CHECK_FALSE(set.contains(11));
+    for(uint64_t key : {3, 19, 27, 5, 100, 200}) {
+        CHECK(set.contains(key));
+    }
+    gen_type gen{24};
+    detail::IndexSet big(1000);
+    std::set<uint64_t> reference;
+    for(int i = 0; i < 100000; ++i) {
+        auto const key = uni_dist<uint64_t>::gen(0, 1500, gen);
+        if(reference.size() < 1000 && uni_dist<int>::gen(0, 1, gen) == 0) {
+            CHECK(big.insert(key) == reference.insert(key).second);
+        } else {
+            CHECK(big.erase(key) == (reference.erase(key) == 1));
+        }
+    }
+    for(uint64_t key = 0; key <= 1500; ++key) {
+        CHECK(big.contains(key) == (reference.count(key) == 1));
+    }
+}
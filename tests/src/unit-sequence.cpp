@@ -35,6 +35,20 @@ TEST_CASE("test_print") {
     CHECK(s.str() == "1 2 3 4 5");
 }
 
+TEST_CASE("test_print_format_flags") {
+    stringstream s{};
+    s << hex << Sequence<int>({10, 255});
+
+    CHECK(s.str() == "a ff");
+}
+
+TEST_CASE("test_print_floating_point") {
+    stringstream s{};
+    s << Sequence<double>({1.5, 65.25, 2.0});
+
+    CHECK(s.str() == "1.5 65.25 2");
+}
+
 TEST_CASE("test_generation_no_indx") {
     Sequence<int> const s(4, [i = 0]() mutable -> int { return ++i; });
     Sequence<int> const exp({1, 2, 3, 4});
@@ -47,4 +61,14 @@ TEST_CASE("test_generation_indx") {
     Sequence<int> const exp({0, 1, 2, 3});
 
     CHECK(s == exp);
-}
\ No newline at end of file
+}
+
+TEST_CASE("test_generation_dist") {
+    gen_type g1{5};
+    gen_type g2{5};
+    uni_dist<int> const dist(-10, 10);
+    Sequence<int> const s(1000, dist, g1);
+    Sequence<int> const exp(1000, [&] { return dist(g2); });
+
+    CHECK(s == exp);
+}
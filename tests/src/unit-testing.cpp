@@ -1,8 +1,13 @@
 #include <doctest.h>
 
+#include <iomanip>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <string>
 #include <type_traits>
 
+#include <testgen/manager.hpp>
 #include <testgen/testing.hpp>
 using namespace test;
 
@@ -50,6 +55,7 @@ TEST_CASE("test_usage_standard_types") {
     test.getTest();
     test << "abc\n";
 
+    test.flush();
     CHECK(s.str() == "next suite\nnext test\n1\n2\na\nnext test\nnext test\nabc\n");
 }
 
@@ -75,6 +81,7 @@ TEST_CASE("test_generating_and_standard_types") {
     test.getTest();
     test << 11 << TestGenerating{} << ' ' << "def";
 
+    test.flush();
     CHECK(s.str() == "next suite\nnext test\n2\n3\n1 3 abc\nnext test\n113 def");
 }
 
@@ -160,3 +167,177 @@ TEST_CASE("test-rng-utilities") {
     using T = std::remove_cv_t<decltype(test)>;
     static_assert(std::is_base_of_v<RngUtilities<T>, T>);
 }
+
+class CapturingStream : public std::stringstream {
+    std::string name;
+
+public:
+    static inline std::mutex mutex{};
+    static inline std::map<std::string, std::string> files{};
+
+    explicit CapturingStream(std::string name) :
+      name{std::move(name)} {}
+    CapturingStream(CapturingStream const &) = delete;
+    CapturingStream(CapturingStream &&) = delete;
+    CapturingStream & operator=(CapturingStream const &) = delete;
+    CapturingStream & operator=(CapturingStream &&) = delete;
+    ~CapturingStream() override {
+        std::lock_guard<std::mutex> const lock{mutex};
+        files[name] += str();
+    }
+};
+
+TEST_CASE("test_parallel_same_as_sequential") {
+    auto const body = [](auto & t) {
+        for(int i = 0; i < 100; ++i) {
+            t << t.randInt(0, 1000) << ' ';
+        }
+        t << t.generateFromSchema(TestGenerating{}) << '\n';
+        for(auto v : t.randInts(100, -5, 5)) {
+            t << v << ' ';
+        }
+    };
+    using manager_t = OIOIOIManager<SILENT, CapturingStream>;
+    {
+        Testing<manager_t> test{"seq", false};
+        for(int i = 0; i < 5; ++i) {
+            test.getTest();
+            body(test);
+        }
+        test.nextSuite();
+        for(int i = 0; i < 5; ++i) {
+            test.getTest();
+            body(test);
+        }
+    }
+    {
+        Testing<manager_t> test{"par", false};
+        for(int i = 0; i < 5; ++i) {
+            test.addTest(body);
+        }
+        test.nextSuite();
+        for(int i = 0; i < 5; ++i) {
+            test.addTest(body);
+        }
+        test.runTests(4);
+    }
+    auto const & files = CapturingStream::files;
+    CHECK(files.size() == 20);
+    for(auto const & [name, content] : files) {
+        if(name.rfind("seq", 0) == 0) {
+            CHECK(files.at("par" + name.substr(3)) == content);
+        }
+    }
+}
+
+TEST_CASE("test_parallel_mixed_with_immediate") {
+    auto const body = [](auto & t) {
+        for(int i = 0; i < 50; ++i) {
+            t << t.randInt(0, 1000) << ' ';
+        }
+    };
+    using manager_t = OIOIOIManager<SILENT, CapturingStream>;
+    {
+        Testing<manager_t> test{"mseq", false};
+        for(int i = 0; i < 3; ++i) {
+            test.getTest();
+            body(test);
+        }
+        test.setTest(1, 1);
+        body(test);
+    }
+    {
+        Testing<manager_t> test{"mpar", false};
+        test.addTest(body);
+        test.addTest(body);
+        test.runTests(2);
+        test.getTest();
+        body(test);
+        test.setTest(1, 1);
+        body(test);
+    }
+    auto const & files = CapturingStream::files;
+    for(auto const * name : {"1a.in", "1b.in", "1c.in"}) {
+        CHECK(files.at(std::string("mseq") + name) == files.at(std::string("mpar") + name));
+    }
+    CHECK(files.at("mpar1a.in").size() > files.at("mpar1b.in").size());
+}
+
+TEST_CASE("test_parallel_assumptions_held") {
+    Testing<OIOIOIManager<SILENT, CapturingStream>, Testcase> test{"held", false};
+    test.assumptionGlobal([](Testcase const & t) { return t.x == 2; });
+    test.addTest([](auto & t) { t << Testcase{2}; });
+    test.addTest([](auto & t) { t << Testcase{2}; });
+    test.runTests(2);
+    CHECK(CapturingStream::files.at("held1b.in") == "2");
+}
+
+DEATH_TEST("test_parallel_assumption_failed") {
+    Testing<OIOIOIManager<SILENT, CapturingStream>, Testcase> test{"fail", false};
+    test.assumptionGlobal([](Testcase const & t) { return t.x == 2; });
+    test.addTest([](auto & t) { t << Testcase{3}; });
+    test.addTest([](auto & t) { t << Testcase{2}; });
+    CHECK_DEATH(test.runTests(2));
+}
+
+TEST_CASE("test_usage_fast_types") {
+    std::stringstream s;
+    Testing<TestManager> test{s};
+
+    test.getTest();
+    test << Sequence<int>({1, 2, 3}) << '\n'
+         << Clique(3).generate()
+         << std::string("end") << ' ' << 7ULL;
+
+    test.flush();
+    CHECK(s.str() == "next test\n1 2 3\n0 1\n0 2\n1 2\nend 7");
+}
+
+TEST_CASE("test_edge_stream") {
+    std::stringstream s;
+    Testing<TestManager> test{s};
+    test.nextTest();
+    test << edgeStream(Star(4), test.generator()) << "end\n";
+    gen_type gen{0};
+    std::stringstream expected;
+    printEdges(expected, edgeStream(Star(4), gen));
+    test.flush();
+    CHECK(s.str() == "next test\n" + expected.str() + "end\n");
+}
+
+TEST_CASE("test_usage_floating_point") {
+    std::stringstream s;
+    Testing<TestManager> test{s};
+    test.getTest();
+    test << 2.5 << ' ' << 100.75F << '\n'
+         << Sequence<double>({1.5, 65.25, 2.0});
+
+    test.flush();
+    CHECK(s.str() == "next test\n2.5 100.75\n1.5 65.25 2");
+}
+
+TEST_CASE("test_usage_format_flags") {
+    std::stringstream s;
+    Testing<TestManager> test{s};
+    test.getTest();
+    test << std::setw(5) << 42 << '|' << std::hex << 255 << ' ' << Sequence<int>({10, 11}) << std::dec << ' ' << 255 << '\n'
+         << Clique(2).generate();
+
+    test.flush();
+    CHECK(s.str() == "next test\n   42|ff a b 255\n0 1\n");
+}
+
+TEST_CASE("test_writer_buffered_between_values") {
+    std::stringstream s;
+    Testing<TestManager> test{s};
+    test.getTest();
+    test << 1 << ' ' << 2.5 << ' ' << Sequence<int>({3, 4}) << std::setw(3) << 5 << ' ' << 6 << ' ' << Testcase{7} << ' ' << 8;
+    CHECK(s.str() == "next test\n1 2.5 3 4  5 6 7");
+    test.getTest();
+    test << 9 << ' ' << 0.5 << '\n';
+    test.nextSuite();
+    test << 10;
+    CHECK(s.str() == "next test\n1 2.5 3 4  5 6 7 8next test\n9 0.5\nnext suite\n");
+    test.flush();
+    CHECK(s.str() == "next test\n1 2.5 3 4  5 6 7 8next test\n9 0.5\nnext suite\n10");
+}
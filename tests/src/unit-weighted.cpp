@@ -0,0 +1,134 @@
+#include <doctest.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <set>
+
+#include <testgen/weighted.hpp>
+using namespace std;
+using namespace test;
+
+TEST_CASE("test-weighted-construct") {
+    WeightedGraph G(3);
+    G.addEdge(0, 1, 5);
+    G.addEdge(1, 2, -3);
+    CHECK(G.size() == 3);
+    CHECK(G.getEdges() == edge_list_t{{0, 1}, {1, 2}});
+    CHECK(G.getWeights() == vector<weight_t>{5, -3});
+    WeightedGraph const H(Path(4).generate());
+    CHECK(H.getEdges().size() == 3);
+    CHECK(H.getWeights() == vector<weight_t>{0, 0, 0});
+    CHECK(H.toCsr().size() == 4);
+}
+
+TEST_CASE("test-weighted-permute") {
+    gen_type gen{1};
+    uint const n = 200;
+    WeightedGraph G(Gnm(n, 1000).generateEdgeList(gen));
+    distinctWeights(G, 1, 1000, gen);
+    // weight identifies edge, so edge with its weight has to survive permutation
+    map<weight_t, pair<uint, uint>> before;
+    for(size_t i = 0; i < G.getEdges().size(); ++i) {
+        before[G.getWeights()[i]] = G.getEdges()[i];
+    }
+    gen_type copy = gen;
+    G.permute(gen);
+    auto const label = get_permutation(n, copy);
+    CHECK(G.getEdges().size() == 1000);
+    for(size_t i = 0; i < G.getEdges().size(); ++i) {
+        auto const [a, b] = before.at(G.getWeights()[i]);
+        auto const edge = G.getEdges()[i];
+        CHECK((edge == pair{label[a], label[b]} || edge == pair{label[b], label[a]}));
+    }
+}
+
+TEST_CASE("test-uniform-weights") {
+    gen_type gen{2};
+    WeightedGraph G(Clique(50).generate());
+    uniformWeights(G, -10, 10, gen);
+    auto const & w = G.getWeights();
+    CHECK(*min_element(w.begin(), w.end()) == -10);
+    CHECK(*max_element(w.begin(), w.end()) == 10);
+}
+
+TEST_CASE("test-distinct-weights") {
+    gen_type gen{3};
+    WeightedGraph G(Clique(50).generate());
+    distinctWeights(G, 100, 100 + 1224, gen);
+    set<weight_t> const values(G.getWeights().begin(), G.getWeights().end());
+    CHECK(values.size() == 1225);
+    CHECK(*values.begin() == 100);
+    CHECK(*values.rbegin() == 1324);
+    CHECK_FALSE(is_sorted(G.getWeights().begin(), G.getWeights().end()));
+    distinctWeights(G, 0, 1'000'000'000'000, gen);
+    CHECK(set<weight_t>(G.getWeights().begin(), G.getWeights().end()).size() == 1225);
+}
+
+TEST_CASE("test-distinct-weights-full-range") {
+    gen_type gen{5};
+    WeightedGraph G(Clique(50).generate());
+    distinctWeights(G, numeric_limits<weight_t>::min(), numeric_limits<weight_t>::max(), gen);
+    set<weight_t> const values(G.getWeights().begin(), G.getWeights().end());
+    CHECK(values.size() == 1225);
+    CHECK(*values.begin() < 0);
+    CHECK(*values.rbegin() > 0);
+}
+
+TEST_CASE("test-metric-weights") {
+    gen_type gen{4};
+    WeightedGraph G(Clique(30).generate());
+    metricWeights(G, 10, gen);
+    map<pair<uint, uint>, weight_t> weight;
+    for(size_t i = 0; i < G.getEdges().size(); ++i) {
+        auto const [a, b] = G.getEdges()[i];
+        REQUIRE(10 <= G.getWeights()[i]);
+        REQUIRE(G.getWeights()[i] <= 20);
+        weight[{a, b}] = weight[{b, a}] = G.getWeights()[i];
+    }
+    for(uint a = 0; a < 30; ++a) {
+        for(uint b = 0; b < 30; ++b) {
+            for(uint c = 0; c < 30; ++c) {
+                if(a != b && b != c && a != c) {
+                    REQUIRE(weight[{a, c}] <= weight[{a, b}] + weight[{b, c}]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("test-anti-dijkstra-weights") {
+    uint const n = 100;
+    WeightedGraph G(Clique(n).generate());
+    antiDijkstraWeights(G);
+    vector<vector<pair<uint, weight_t>>> adj(n);
+    for(size_t i = 0; i < G.getEdges().size(); ++i) {
+        auto const [a, b] = G.getEdges()[i];
+        adj[a].emplace_back(b, G.getWeights()[i]);
+        adj[b].emplace_back(a, G.getWeights()[i]);
+    }
+    // Dijkstra which counts pushes
+    vector<weight_t> dist(n, numeric_limits<weight_t>::max());
+    priority_queue<pair<weight_t, uint>, vector<pair<weight_t, uint>>, greater<>> heap;
+    dist[0] = 0;
+    heap.emplace(0, 0);
+    size_t pushes = 1;
+    while(!heap.empty()) {
+        auto const [d, w] = heap.top();
+        heap.pop();
+        if(d != dist[w]) { continue; }
+        for(auto [v, c] : adj[w]) {
+            if(d + c < dist[v]) {
+                dist[v] = d + c;
+                heap.emplace(dist[v], v);
+                ++pushes;
+            }
+        }
+    }
+    for(uint v = 0; v < n; ++v) {
+        CHECK(dist[v] == v);
+    }
+    CHECK(pushes > n * (n - 1) / 2 - n);
+}